@@ -35,6 +35,8 @@ sub next_entry($$$);
 sub generate_cesbi_h($$);
 sub generate_encnames_h(@);
 sub generate_aliasesbi_c($);
+sub generate_aliashash_h($);
+sub alias_hash($$);
 sub generate_encoding_aliases_c($);
 sub generate_cesdeps_h($);
 sub generate_ccsbi_h($);
@@ -65,6 +67,7 @@ my $var_from_ucs_handlers = '_iconv_from_ucs_ces_handlers_';
 my $var_to_ucs_handlers   = '_iconv_to_ucs_ces_handlers_';
 my $var_ccs       = '_iconv_ccs_';
 my $var_aliases   = '_iconv_aliases';
+my $var_alias_hash = '_iconv_alias';
 my $var_ces_names = 'iconv_ces_names_';
 
 # ==============================================================================
@@ -317,6 +320,9 @@ sub process_section_encodings($)
 
   # Generate aliasesbi.c file
   generate_aliasesbi_c (\%encalias);
+
+  # Generate aliashash.h header file
+  generate_aliashash_h (\%encalias);
   
   # Generate encoding.aliases file
   generate_encoding_aliases (\%encalias);
@@ -603,6 +609,140 @@ sub generate_aliasesbi_c($)
   close ALIASESBI_C or err "Error while closing ../lib/aliasesbi.c file.";
 }
 
+# ==============================================================================
+#
+# Hash function used by the aliases perfect hash. Must match alias_hash() in
+# ../lib/aliasesi.c.
+#
+# Parameter 1: encoding name or alias in canonical form.
+# Parameter 2: seed.
+#
+# ==============================================================================
+sub alias_hash($$)
+{
+  my $h = (2166136261 ^ $_[1]) & 0xFFFFFFFF;
+
+  foreach my $c (unpack ("C*", $_[0]))
+  {
+    $h ^= $c;
+    $h = ($h * 16777619) & 0xFFFFFFFF;
+  }
+
+  return $h;
+}
+
+# ==============================================================================
+#
+# Generate aliashash.h header file with a perfect hash of all encoding names
+# and aliases.
+#
+# The key is hashed with seed 0 to select a bucket, and with the bucket's
+# seed to select a slot. The seeds are chosen so that no two keys share a
+# slot. The hash covers all known encodings, entries of encodings which are
+# not enabled are compiled as empty slots.
+#
+# Parameters: hash reference with keys = encodings and values = aliases string.
+#
+# ==============================================================================
+sub generate_aliashash_h($)
+{
+  my %keyenc;
+  my @keys;
+
+  # Names and aliases in canonical form, the first encoding wins
+  foreach my $enc (sort keys %{$_[0]})
+  {
+    my @aliases = ($enc);
+    push @aliases, split (/\s+/, ${$_[0]}{$enc}) if defined ${$_[0]}{$enc};
+    foreach my $alias (@aliases)
+    {
+      next if $alias eq '';
+      $alias = lc $alias;
+      $alias =~ tr/-/_/;
+      next if defined $keyenc{$alias};
+      $keyenc{$alias} = $enc;
+      push @keys, $alias;
+    }
+  }
+
+  my $nbuckets = 1;
+  $nbuckets *= 2 while $nbuckets * 4 < @keys;
+  my $nslots = 1;
+  $nslots *= 2 while $nslots < @keys;
+
+  my @buckets;
+  push @{$buckets[alias_hash ($_, 0) & ($nbuckets - 1)]}, $_ foreach (@keys);
+
+  my @seeds = (0) x $nbuckets;
+  my @slots;
+  foreach my $b (sort { scalar (@{$buckets[$b] || []})
+                        <=> scalar (@{$buckets[$a] || []}) || $a <=> $b }
+                 (0 .. $nbuckets - 1))
+  {
+    next if !defined $buckets[$b];
+    SEED: for (my $seed = 1; ; $seed += 1)
+    {
+      err "(generate_aliashash_h()) Can't build the aliases hash"
+      if $seed > 65535;
+
+      my %used;
+      foreach (@{$buckets[$b]})
+      {
+        my $slot = alias_hash ($_, $seed) & ($nslots - 1);
+        next SEED if defined $slots[$slot] or defined $used{$slot};
+        $used{$slot} = $_;
+      }
+      $slots[$_] = $used{$_} foreach (keys %used);
+      $seeds[$b] = $seed;
+      last;
+    }
+  }
+
+  print "Debug: create \"../lib/aliashash.h\" file.\n" if $verbose;
+  open (ALIASHASH_H, '>', "../lib/aliashash.h")
+  or err "Can't create \"../lib/aliashash.h\" file for writing.\nSystem error message: $!.\n";
+
+  print ALIASHASH_H "$comment_automatic\n\n";
+  print ALIASHASH_H "#ifndef __ALIASHASH_H__\n";
+  print ALIASHASH_H "#define __ALIASHASH_H__\n\n";
+  print ALIASHASH_H "#include \"encnames.h\"\n\n";
+  print ALIASHASH_H "#define ICONV_ALIAS_BUCKETS $nbuckets\n";
+  print ALIASHASH_H "#define ICONV_ALIAS_SLOTS $nslots\n\n";
+
+  print ALIASHASH_H "static const __uint16_t\n";
+  print ALIASHASH_H "${var_alias_hash}_seeds[ICONV_ALIAS_BUCKETS] =\n";
+  print ALIASHASH_H "{";
+  for (my $i = 0; $i < $nbuckets; $i += 1)
+  {
+    print ALIASHASH_H $i % 8 ? " " : "\n  ";
+    print ALIASHASH_H "$seeds[$i],";
+  }
+  print ALIASHASH_H "\n};\n\n";
+
+  print ALIASHASH_H "static const iconv_alias_t\n";
+  print ALIASHASH_H "${var_alias_hash}_slots[ICONV_ALIAS_SLOTS] =\n";
+  print ALIASHASH_H "{\n";
+  for (my $i = 0; $i < $nslots; $i += 1)
+  {
+    if (!defined $slots[$i])
+    {
+      print ALIASHASH_H "  {NULL, NULL},\n";
+      next;
+    }
+    my $enc = $keyenc{$slots[$i]};
+    print ALIASHASH_H "#if defined ($macro_from_enc\U$enc) \\\n";
+    print ALIASHASH_H " || defined ($macro_to_enc\U$enc)\n";
+    print ALIASHASH_H "  {\"$slots[$i]\", $macro_enc_name\U$enc\E},\n";
+    print ALIASHASH_H "#else\n";
+    print ALIASHASH_H "  {NULL, NULL},\n";
+    print ALIASHASH_H "#endif\n";
+  }
+  print ALIASHASH_H "};\n\n";
+  print ALIASHASH_H "#endif /* !__ALIASHASH_H__ */\n\n";
+
+  close ALIASHASH_H or err "Error while closing ../lib/aliashash.h file.";
+}
+
 # ==============================================================================
 #
 # Generate encoding.aliases file.
@@ -36,6 +36,7 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/lock.h>
 #include <sys/iconvnls.h>
 #include "../lib/endian.h"
 #include "../lib/local.h"
@@ -54,8 +55,25 @@
  * (only if corespondent capability was enabled in Newlib configuration). 
  *
  * 16 bit encodings are assumed to be Big Endian.
+ *
+ * Table descriptions never change once initialized, so they are shared by
+ * all conversions and cached until the process exits. Opening a conversion
+ * doesn't allocate them or load external tables again.
  */
 
+/* Cached table description */
+typedef struct table_cache
+{
+  struct table_cache *next;
+  const iconv_ccs_desc_t *ccsp;
+  int direction;  /* 0 - "To UCS" table, 1 - "From UCS" table */
+  char name[1];   /* CCS name, allocated with the structure */
+} table_cache_t;
+
+static table_cache_t *table_cache;
+
+__LOCK_INIT(static, table_cache_lock);
+
 static ucs2_t
 find_code_size (ucs2_t code, const __uint16_t *tblp);
 
@@ -77,26 +95,47 @@ static size_t
 table_close (struct _reent *rptr,
                     void *data)
 {
-  const iconv_ccs_desc_t *ccsp = (iconv_ccs_desc_t *)data;
+  /* Table descriptions are cached, see table_init() */
+  return 0;
+}
 
+static void
+table_free (struct _reent *rptr,
+                   const iconv_ccs_desc_t *ccsp)
+{
   if (ccsp->type == TABLE_EXTERNAL)
     _free_r (rptr, (void *)ccsp->tbl);
 
-  _free_r( rptr, (void *)ccsp);
-  return 0;
+  _free_r (rptr, (void *)ccsp);
 }
 
-#if defined (ICONV_FROM_UCS_CES_TABLE)
-static void *
-table_init_from_ucs (struct _reent *rptr,
-                            const char *encoding)
+/*
+ * table_find - create table description.
+ *
+ * PARAMETERS:
+ *    struct _reent *rptr - reent structure of current thread/process.
+ *    const char *name - encoding name.
+ *    int direction - conversion direction.
+ *
+ * DESCRIPTION:
+ *    Initializes 'iconv_ccs_desc_t' table description structure for
+ *    built-in CCS table 'name' or loads it from external file. If
+ *    'direction' is 0 - use "To UCS" table, else use "From UCS" table.
+ *
+ * RETURN:
+ *    iconv_ccs_desc_t * pointer is success, NULL if failure.
+ */
+static const iconv_ccs_desc_t *
+table_find (struct _reent *rptr,
+                   const char *name,
+                   int direction)
 {
   int i;
   const iconv_ccs_t *biccsp = NULL;
   iconv_ccs_desc_t *ccsp;
   
   for (i = 0; _iconv_ccs[i] != NULL; i++)
-    if (strcmp (_iconv_ccs[i]->name, encoding) == 0)
+    if (strcmp (_iconv_ccs[i]->name, name) == 0)
       {
         biccsp = _iconv_ccs[i]; 
         break;
@@ -104,26 +143,119 @@ table_init_from_ucs (struct _reent *rptr,
 
   if (biccsp != NULL)
     {
-      if (biccsp->from_ucs == NULL
+      if ((direction ? biccsp->from_ucs : biccsp->to_ucs) == NULL
           || (ccsp = (iconv_ccs_desc_t *)
                      _malloc_r (rptr, sizeof (iconv_ccs_desc_t))) == NULL)
         return NULL;
 
       ccsp->type = TABLE_BUILTIN;
       ccsp->bits = biccsp->bits;
-      ccsp->optimization = biccsp->from_ucs_type;
-      ccsp->tbl = biccsp->from_ucs;
+      if (direction)
+        {
+          ccsp->optimization = biccsp->from_ucs_type;
+          ccsp->tbl = biccsp->from_ucs;
+        }
+      else
+        {
+          ccsp->optimization = biccsp->to_ucs_type;
+          ccsp->tbl = biccsp->to_ucs;
+        }
       
-      return (void *)ccsp;
+      return ccsp;
     }
-    
+  
 #ifdef _ICONV_ENABLE_EXTERNAL_CCS
-  return (void *)load_file (rptr, encoding, 1);
+  return load_file (rptr, name, direction);
 #else
   return NULL;
 #endif
 }
 
+/* Must be called with table_cache_lock held */
+static table_cache_t *
+table_lookup (const char *name,
+                     int direction)
+{
+  table_cache_t *tc;
+
+  for (tc = table_cache; tc != NULL; tc = tc->next)
+    if (tc->direction == direction && strcmp (tc->name, name) == 0)
+      break;
+
+  return tc;
+}
+
+/*
+ * table_init - get table description.
+ *
+ * PARAMETERS:
+ *    struct _reent *rptr - reent structure of current thread/process.
+ *    const char *encoding - encoding name.
+ *    int direction - conversion direction.
+ *
+ * DESCRIPTION:
+ *    Returns the cached description of the 'encoding' table for 'direction',
+ *    creating it with table_find() on first use. The lock isn't held while
+ *    the table is created, so two threads may both create it; the second
+ *    one frees its copy and uses the cached one.
+ *
+ * RETURN:
+ *    iconv_ccs_desc_t * pointer is success, NULL if failure.
+ */
+static void *
+table_init (struct _reent *rptr,
+                   const char *encoding,
+                   int direction)
+{
+  table_cache_t *tc, *found;
+  const iconv_ccs_desc_t *ccsp;
+  size_t len;
+
+  __lock_acquire (table_cache_lock);
+  found = table_lookup (encoding, direction);
+  __lock_release (table_cache_lock);
+
+  if (found != NULL)
+    return (void *)found->ccsp;
+
+  if ((ccsp = table_find (rptr, encoding, direction)) == NULL)
+    return NULL;
+
+  len = strlen (encoding);
+  if ((tc = (table_cache_t *)
+            _malloc_r (rptr, sizeof (table_cache_t) + len)) == NULL)
+    {
+      table_free (rptr, ccsp);
+      return NULL;
+    }
+  tc->ccsp = ccsp;
+  tc->direction = direction;
+  memcpy (tc->name, encoding, len + 1);
+
+  __lock_acquire (table_cache_lock);
+  if ((found = table_lookup (encoding, direction)) == NULL)
+    {
+      tc->next = table_cache;
+      table_cache = tc;
+    }
+  __lock_release (table_cache_lock);
+
+  if (found == NULL)
+    return (void *)ccsp;
+
+  table_free (rptr, ccsp);
+  _free_r (rptr, (void *)tc);
+  return (void *)found->ccsp;
+}
+
+#if defined (ICONV_FROM_UCS_CES_TABLE)
+static void *
+table_init_from_ucs (struct _reent *rptr,
+                            const char *encoding)
+{
+  return table_init (rptr, encoding, 1);
+}
+
 static size_t
 table_convert_from_ucs (void *data,
                                ucs4_t in,
@@ -172,37 +304,7 @@ static void *
 table_init_to_ucs (struct _reent *rptr,
                           const char *encoding)
 {
-  int i;
-  const iconv_ccs_t *biccsp = NULL;
-  iconv_ccs_desc_t *ccsp;
-  
-  for (i = 0; _iconv_ccs[i] != NULL; i++)
-    if (strcmp (_iconv_ccs[i]->name, encoding) == 0)
-      {
-        biccsp = _iconv_ccs[i]; 
-        break;
-      }
-
-  if (biccsp != NULL)
-    {
-      if (biccsp->to_ucs == NULL
-          || (ccsp = (iconv_ccs_desc_t *)
-                     _malloc_r (rptr, sizeof (iconv_ccs_desc_t))) == NULL)
-        return NULL;
-
-      ccsp->type = TABLE_BUILTIN;
-      ccsp->bits = biccsp->bits;
-      ccsp->optimization = biccsp->to_ucs_type;
-      ccsp->tbl = biccsp->to_ucs;
-      
-      return (void *)ccsp;
-    }
-  
-#ifdef _ICONV_ENABLE_EXTERNAL_CCS
-  return (void *)load_file (rptr, encoding, 0);
-#else
-  return NULL;
-#endif
+  return table_init (rptr, encoding, 0);
 }
 
 static ucs4_t
@@ -29,104 +29,98 @@
 #include <string.h>
 #include <stdlib.h>
 #include <errno.h>
-#include <ctype.h>
 #include <sys/iconvnls.h>
 #include "local.h"
+#include "aliashash.h"
 
 /*
- * canonical_form - canonize 'str'.
+ * canonical_char - canonize character 'c'.
  *
  * PARAMETERS:
- *   struct _reent *rptr - reent structure of current thread/process.
- *   const char *str    - string to canonize. 
+ *   char c - character of an encoding name or alias.
  *
  * DESCRIPTION:
- *   Converts all letters to small and substitute all '-' characters by '_'
- *   characters.
+ *   Converts letters to small and substitutes '-' by '_'. Encoding names
+ *   are plain ASCII, so this does not depend on the current locale.
  *
  * RETURN:
- *   Returns canonical form of 'str' if success, NULL if failure.
+ *   Canonical form of 'c'.
  */
-static const char *
-canonical_form (struct _reent *rptr,
-                       const char *str)
+static __inline unsigned char
+canonical_char (char c)
 {
-  char *p, *p1;
+  if (c == '-')
+    return '_';
+  if (c >= 'A' && c <= 'Z')
+    return c - 'A' + 'a';
+  return (unsigned char)c;
+}
 
-  if (str == NULL || (p = p1 = _strdup_r (rptr, str)) == NULL)
-    return (const char *)NULL;
+/*
+ * alias_hash - hash encoding name or alias.
+ *
+ * PARAMETERS:
+ *   const char *str - encoding name or alias.
+ *   __uint32_t seed - hash seed.
+ *
+ * DESCRIPTION:
+ *   Computes the FNV-1a hash of the canonical form of 'str'. Must match
+ *   alias_hash() in ../ces/mkdeps.pl which generates aliashash.h.
+ *
+ * RETURN:
+ *   Hash value.
+ */
+static __uint32_t
+alias_hash (const char *str,
+                   __uint32_t seed)
+{
+  __uint32_t h = 2166136261U ^ seed;
 
-  for (; *str; str++, p++)
+  for (; *str; str++)
     {
-      if (*str == '-')
-        *p = '_';
-      else
-        *p = tolower (*str);
+      h ^= canonical_char (*str);
+      h *= 16777619U;
     }
 
-  return (const char *)p1;
+  return h;
 }
 
 /*
- * find_alias - find encoding name name by it's alias. 
+ * _iconv_find_encoding_name - find encoding's name by given alias.
  *
  * PARAMETERS:
- *   struct _reent *rptr - reent structure of current thread/process.
- *   const char *alias  - alias by which "official" name should be found.
- *   const char *table  - aliases table.
- *   int len             - aliases table length.
+ *   const char *ca - encoding alias to resolve.
  *
  * DESCRIPTION:
- *   'table' contains the list of encoding names and aliases. 
- *    Names go first, e.g.:
- *
- *   name1 alias11 alias12 alias1N
- *   name2 alias21 alias22 alias2N
- *   nameM aliasM1 aliasM2 aliasMN
- *
- *   If line begins with backspace it is considered as the continuation of
- *   previous line.
+ *   Looks 'ca' up in the perfect hash of built-in names and aliases: the
+ *   hash with seed 0 selects a bucket, the hash with the bucket's seed
+ *   selects the only slot the alias can be stored in.
  *
  * RETURN:
- *   Returns pointer to name found if success. In case of error returns NULL
- *   and sets current thread's/process's errno.
+ *   Encoding name if found, NULL otherwise. The name is a constant string
+ *   and must not be freed.
  */
-static char *
-find_alias (struct _reent *rptr,
-                   const char *alias,
-                   const char *table,
-                   int len)
+const char *
+_iconv_find_encoding_name (const char *ca)
 {
-  const char *end;
-  const char *p;
-  int l = strlen (alias);
-  const char *ptable = table;
-  const char *table_end = table + len;
-
-  if (table == NULL || alias == NULL || *table == '\0' || *alias == '\0')
-    return NULL;
+  const iconv_alias_t *slot;
+  const char *p, *q;
+  __uint32_t bucket;
 
-search_again:
-  if (len < l || (p = strnstr (ptable, alias, len)) == NULL)
-    return NULL;
-  
-  /* Check that substring is segregated by '\n', '\t' or ' ' */
-  if (!((p == table || isspace (*(p-1)) || *(p-1) == '\n')
-     && (p+l == table_end || isspace (*(p+l)) || *(p+l) == '\n')))
-    {
-      ptable = p + l;
-      len -= table - p;
-      goto search_again;
-    }
-
-  while(--p > table && *p != '\n');
+  /* Alias shouldn't contain white spaces, '\n' and '\r' symbols */ 
+  for (p = ca; *p; p++)
+    if (*p == ' ' || *p == '\r' || *p == '\n')
+      return NULL;
 
-  if (*(++p) == '#')
+  bucket = alias_hash (ca, 0) & (ICONV_ALIAS_BUCKETS - 1);
+  slot = &_iconv_alias_slots[alias_hash (ca, _iconv_alias_seeds[bucket])
+                             & (ICONV_ALIAS_SLOTS - 1)];
+  if (slot->alias == NULL)
     return NULL;
 
-  for (end = p + 1; !isspace (*end) && *end != '\n' && *end != '\0'; end++);
+  for (p = ca, q = slot->alias; *p && canonical_char (*p) == *q; p++, q++);
 
-  return _strndup_r (rptr, p, (size_t)(end - p));
+  return *p == '\0' && *q == '\0' ? slot->name : NULL;
 }
 
 /*
@@ -137,8 +131,8 @@ search_again:
  *   const char *ca     - encoding alias to resolve.
  *
  * DESCRIPTION: 
- *   First, tries to find 'ca' among built-in aliases. If not found, tries to 
- *   find it external file.
+ *   Finds 'ca' among built-in aliases and returns a copy of the encoding
+ *   name.
  *
  * RETURN:
  *   Encoding name if found. In case of error returns NULL
@@ -148,19 +142,10 @@ char *
 _iconv_resolve_encoding_name (struct _reent *rptr,
                                      const char *ca)
 {
-  char *p = (char *)ca;
+  const char *name;
 
-  /* Alias shouldn't contain white spaces, '\n' and '\r' symbols */ 
-  while (*p)
-    if (*p == ' ' || *p == '\r' || *p++ == '\n')
-      return NULL;
-    
-  if ((ca = canonical_form (rptr, ca)) == NULL)
+  if ((name = _iconv_find_encoding_name (ca)) == NULL)
     return NULL;
 
-  p = find_alias (rptr, ca, _iconv_aliases, strlen (_iconv_aliases));
-  
-  _free_r (rptr, (void *)ca);
-  return p;
+  return _strdup_r (rptr, name);
 }
-
@@ -0,0 +1,1343 @@
+/*
+ * This file was automatically generated mkdeps.pl script. Don't edit.
+ */
+
+#ifndef __ALIASHASH_H__
+#define __ALIASHASH_H__
+
+#include "encnames.h"
+
+#define ICONV_ALIAS_BUCKETS 64
+#define ICONV_ALIAS_SLOTS 256
+
+static const __uint16_t
+_iconv_alias_seeds[ICONV_ALIAS_BUCKETS] =
+{
+  13, 97, 1, 1, 2, 4, 1, 4,
+  33, 3, 4, 0, 12, 1, 5, 5,
+  1, 11, 3, 1, 4, 36, 7, 10,
+  4, 4, 5, 3, 13, 13, 4, 2,
+  0, 1, 8, 1, 76, 1, 11, 5,
+  1, 12, 14, 1, 0, 1, 10, 20,
+  10, 11, 21, 21, 1, 1, 32, 14,
+  0, 6, 90, 28, 33, 16, 8, 0,
+};
+
+static const iconv_alias_t
+_iconv_alias_slots[ICONV_ALIAS_SLOTS] =
+{
+#if defined (_ICONV_FROM_ENCODING_WIN_1254) \
+ || defined (_ICONV_TO_ENCODING_WIN_1254)
+  {"cp1254", ICONV_ENCODING_WIN_1254},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  {"iso8859_2", ICONV_ENCODING_ISO_8859_2},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  {"iso88592", ICONV_ENCODING_ISO_8859_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  {"iso_10646_ucs_2", ICONV_ENCODING_UCS_2},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_8) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_8)
+  {"iso_ir_138", ICONV_ENCODING_ISO_8859_8},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"iso88597", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_EUC_KR) \
+ || defined (_ICONV_TO_ENCODING_EUC_KR)
+  {"euckr", ICONV_ENCODING_EUC_KR},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_5) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_5)
+  {"iso8859_5", ICONV_ENCODING_ISO_8859_5},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_8) \
+ || defined (_ICONV_TO_ENCODING_UTF_8)
+  {"utf_8", ICONV_ENCODING_UTF_8},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  {"iso_ir_148", ICONV_ENCODING_ISO_8859_9},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_U) \
+ || defined (_ICONV_TO_ENCODING_KOI8_U)
+  {"koi8u", ICONV_ENCODING_KOI8_U},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_UNI) \
+ || defined (_ICONV_TO_ENCODING_KOI8_UNI)
+  {"koi8uni", ICONV_ENCODING_KOI8_UNI},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"greek", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  {"l3", ICONV_ENCODING_ISO_8859_3},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_WIN_1253) \
+ || defined (_ICONV_TO_ENCODING_WIN_1253)
+  {"cp1253", ICONV_ENCODING_WIN_1253},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4) \
+ || defined (_ICONV_TO_ENCODING_UCS_4)
+  {"iso_10646_ucs4", ICONV_ENCODING_UCS_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4LE) \
+ || defined (_ICONV_TO_ENCODING_UCS_4LE)
+  {"ucs4le", ICONV_ENCODING_UCS_4LE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP866) \
+ || defined (_ICONV_TO_ENCODING_CP866)
+  {"cp866", ICONV_ENCODING_CP866},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_8) \
+ || defined (_ICONV_TO_ENCODING_UTF_8)
+  {"utf8", ICONV_ENCODING_UTF_8},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP866) \
+ || defined (_ICONV_TO_ENCODING_CP866)
+  {"csibm866", ICONV_ENCODING_CP866},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_5) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_5)
+  {"csisolatincyrillic", ICONV_ENCODING_ISO_8859_5},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"us_ascii", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  {"iso10646ucs2", ICONV_ENCODING_UCS_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_4_INTERNAL)
+  {"ucs4_internal", ICONV_ENCODING_UCS_4_INTERNAL},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  {"iso_8859_4:1988", ICONV_ENCODING_ISO_8859_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"iso_ir_127", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2LE) \
+ || defined (_ICONV_TO_ENCODING_UCS_2LE)
+  {"ucs_2le", ICONV_ENCODING_UCS_2LE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP866) \
+ || defined (_ICONV_TO_ENCODING_CP866)
+  {"866", ICONV_ENCODING_CP866},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"ansi_x3.4_1986", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_UCS_2_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_2_INTERNAL)
+  {"ucs2_internal", ICONV_ENCODING_UCS_2_INTERNAL},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_16) \
+ || defined (_ICONV_TO_ENCODING_UTF_16)
+  {"utf16", ICONV_ENCODING_UTF_16},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_5) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_5)
+  {"iso_ir_144", ICONV_ENCODING_ISO_8859_5},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_RU) \
+ || defined (_ICONV_TO_ENCODING_KOI8_RU)
+  {"koi8_ru", ICONV_ENCODING_KOI8_RU},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_5) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_5)
+  {"iso_8859_5:1988", ICONV_ENCODING_ISO_8859_5},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4LE) \
+ || defined (_ICONV_TO_ENCODING_UCS_4LE)
+  {"ucs_4le", ICONV_ENCODING_UCS_4LE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"ibm819", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_14) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_14)
+  {"iso885914", ICONV_ENCODING_ISO_8859_14},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  {"csisolatin2", ICONV_ENCODING_ISO_8859_2},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_UCS_2BE) \
+ || defined (_ICONV_TO_ENCODING_UCS_2BE)
+  {"ucs2be", ICONV_ENCODING_UCS_2BE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  {"latin4", ICONV_ENCODING_ISO_8859_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"iso_8859_7", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_KOI8_RU) \
+ || defined (_ICONV_TO_ENCODING_KOI8_RU)
+  {"koi8ru", ICONV_ENCODING_KOI8_RU},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP775) \
+ || defined (_ICONV_TO_ENCODING_CP775)
+  {"cspc775baltic", ICONV_ENCODING_CP775},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  {"iso_8859_9", ICONV_ENCODING_ISO_8859_9},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_14) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_14)
+  {"iso_8859_14:1998", ICONV_ENCODING_ISO_8859_14},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_16BE) \
+ || defined (_ICONV_TO_ENCODING_UTF_16BE)
+  {"utf_16be", ICONV_ENCODING_UTF_16BE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_IR_111) \
+ || defined (_ICONV_TO_ENCODING_ISO_IR_111)
+  {"csiso111ecmacyrillic", ICONV_ENCODING_ISO_IR_111},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP855) \
+ || defined (_ICONV_TO_ENCODING_CP855)
+  {"cp855", ICONV_ENCODING_CP855},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_2_INTERNAL)
+  {"ucs_2internal", ICONV_ENCODING_UCS_2_INTERNAL},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"arabic", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_BIG5) \
+ || defined (_ICONV_TO_ENCODING_BIG5)
+  {"cp950", ICONV_ENCODING_BIG5},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_13) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_13)
+  {"iso8859_13", ICONV_ENCODING_ISO_8859_13},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_IR_111) \
+ || defined (_ICONV_TO_ENCODING_ISO_IR_111)
+  {"iso_ir_111", ICONV_ENCODING_ISO_IR_111},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_16LE) \
+ || defined (_ICONV_TO_ENCODING_UTF_16LE)
+  {"utf_16le", ICONV_ENCODING_UTF_16LE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_11) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_11)
+  {"iso_8859_11", ICONV_ENCODING_ISO_8859_11},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  {"iso_ir_109", ICONV_ENCODING_ISO_8859_3},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_14) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_14)
+  {"iso8859_14", ICONV_ENCODING_ISO_8859_14},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_EUC_TW) \
+ || defined (_ICONV_TO_ENCODING_EUC_TW)
+  {"euctw", ICONV_ENCODING_EUC_TW},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_15) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_15)
+  {"iso_8859_15:1998", ICONV_ENCODING_ISO_8859_15},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP866) \
+ || defined (_ICONV_TO_ENCODING_CP866)
+  {"ibm866", ICONV_ENCODING_CP866},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_UTF_16LE) \
+ || defined (_ICONV_TO_ENCODING_UTF_16LE)
+  {"utf16le", ICONV_ENCODING_UTF_16LE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1258) \
+ || defined (_ICONV_TO_ENCODING_WIN_1258)
+  {"cp1258", ICONV_ENCODING_WIN_1258},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_13) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_13)
+  {"iso_8859_13", ICONV_ENCODING_ISO_8859_13},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"latin1", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"iso88596", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_WIN_1257) \
+ || defined (_ICONV_TO_ENCODING_WIN_1257)
+  {"cp1257", ICONV_ENCODING_WIN_1257},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  {"iso_8859_3:1988", ICONV_ENCODING_ISO_8859_3},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP850) \
+ || defined (_ICONV_TO_ENCODING_CP850)
+  {"ibm850", ICONV_ENCODING_CP850},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  {"iso88593", ICONV_ENCODING_ISO_8859_3},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_EUC_TW) \
+ || defined (_ICONV_TO_ENCODING_EUC_TW)
+  {"euc_tw", ICONV_ENCODING_EUC_TW},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_BIG5) \
+ || defined (_ICONV_TO_ENCODING_BIG5)
+  {"csbig5", ICONV_ENCODING_BIG5},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  {"iso8859_9", ICONV_ENCODING_ISO_8859_9},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  {"iso_8859_2", ICONV_ENCODING_ISO_8859_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"iso_8859_1:1987", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_CP775) \
+ || defined (_ICONV_TO_ENCODING_CP775)
+  {"ibm775", ICONV_ENCODING_CP775},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_WIN_1251) \
+ || defined (_ICONV_TO_ENCODING_WIN_1251)
+  {"win_1251", ICONV_ENCODING_WIN_1251},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_U) \
+ || defined (_ICONV_TO_ENCODING_KOI8_U)
+  {"koi8_u", ICONV_ENCODING_KOI8_U},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_BIG5) \
+ || defined (_ICONV_TO_ENCODING_BIG5)
+  {"bigfive", ICONV_ENCODING_BIG5},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4) \
+ || defined (_ICONV_TO_ENCODING_UCS_4)
+  {"iso10646_ucs4", ICONV_ENCODING_UCS_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4BE) \
+ || defined (_ICONV_TO_ENCODING_UCS_4BE)
+  {"ucs4be", ICONV_ENCODING_UCS_4BE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  {"l5", ICONV_ENCODING_ISO_8859_9},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1256) \
+ || defined (_ICONV_TO_ENCODING_WIN_1256)
+  {"win_1256", ICONV_ENCODING_WIN_1256},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  {"latin2", ICONV_ENCODING_ISO_8859_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_11) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_11)
+  {"iso885911", ICONV_ENCODING_ISO_8859_11},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"csisolatinarabic", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1252) \
+ || defined (_ICONV_TO_ENCODING_WIN_1252)
+  {"win_1252", ICONV_ENCODING_WIN_1252},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_5) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_5)
+  {"iso_8859_5", ICONV_ENCODING_ISO_8859_5},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"iso_646.irv:1991", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_UCS_2_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_2_INTERNAL)
+  {"ucs_2_internal", ICONV_ENCODING_UCS_2_INTERNAL},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_EUC_KR) \
+ || defined (_ICONV_TO_ENCODING_EUC_KR)
+  {"euc_kr", ICONV_ENCODING_EUC_KR},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"iso88591", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_8) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_8)
+  {"iso_8859_8:1988", ICONV_ENCODING_ISO_8859_8},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"iso_8859_6", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_14) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_14)
+  {"iso_8859_14", ICONV_ENCODING_ISO_8859_14},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP852) \
+ || defined (_ICONV_TO_ENCODING_CP852)
+  {"cspcp852", ICONV_ENCODING_CP852},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_8) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_8)
+  {"iso88598", ICONV_ENCODING_ISO_8859_8},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  {"csisolatin5", ICONV_ENCODING_ISO_8859_9},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_CP855) \
+ || defined (_ICONV_TO_ENCODING_CP855)
+  {"ibm855", ICONV_ENCODING_CP855},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  {"latin5", ICONV_ENCODING_ISO_8859_9},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"ecma_114", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_11) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_11)
+  {"iso8859_11", ICONV_ENCODING_ISO_8859_11},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  {"iso_ir_157", ICONV_ENCODING_ISO_8859_10},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP852) \
+ || defined (_ICONV_TO_ENCODING_CP852)
+  {"ibm852", ICONV_ENCODING_CP852},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  {"iso_ir_101", ICONV_ENCODING_ISO_8859_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  {"iso_8859_4", ICONV_ENCODING_ISO_8859_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"iso8859_1", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_5) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_5)
+  {"cyrillic", ICONV_ENCODING_ISO_8859_5},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_KOI8_R) \
+ || defined (_ICONV_TO_ENCODING_KOI8_R)
+  {"koi8", ICONV_ENCODING_KOI8_R},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  {"iso885910", ICONV_ENCODING_ISO_8859_10},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2LE) \
+ || defined (_ICONV_TO_ENCODING_UCS_2LE)
+  {"ucs2le", ICONV_ENCODING_UCS_2LE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"iso_ir_100", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  {"csisolatin3", ICONV_ENCODING_ISO_8859_3},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_UCS_2BE) \
+ || defined (_ICONV_TO_ENCODING_UCS_2BE)
+  {"ucs_2be", ICONV_ENCODING_UCS_2BE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"elot_928", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_WIN_1253) \
+ || defined (_ICONV_TO_ENCODING_WIN_1253)
+  {"win_1253", ICONV_ENCODING_WIN_1253},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"ecma_118", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_IR_111) \
+ || defined (_ICONV_TO_ENCODING_ISO_IR_111)
+  {"ecma_cyrillic", ICONV_ENCODING_ISO_IR_111},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_15) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_15)
+  {"iso_8859_15", ICONV_ENCODING_ISO_8859_15},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1250) \
+ || defined (_ICONV_TO_ENCODING_WIN_1250)
+  {"win_1250", ICONV_ENCODING_WIN_1250},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4) \
+ || defined (_ICONV_TO_ENCODING_UCS_4)
+  {"iso10646_ucs_4", ICONV_ENCODING_UCS_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"iso_8859_1", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4) \
+ || defined (_ICONV_TO_ENCODING_UCS_4)
+  {"ucs4", ICONV_ENCODING_UCS_4},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  {"csisolatin4", ICONV_ENCODING_ISO_8859_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP850) \
+ || defined (_ICONV_TO_ENCODING_CP850)
+  {"cspc850multilingual", ICONV_ENCODING_CP850},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  {"iso_8859_9:1989", ICONV_ENCODING_ISO_8859_9},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  {"iso10646_ucs2", ICONV_ENCODING_UCS_2},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_CP852) \
+ || defined (_ICONV_TO_ENCODING_CP852)
+  {"cp852", ICONV_ENCODING_CP852},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"iso8859_6", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_IR_111) \
+ || defined (_ICONV_TO_ENCODING_ISO_IR_111)
+  {"koi8_e", ICONV_ENCODING_ISO_IR_111},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_EUC_JP) \
+ || defined (_ICONV_TO_ENCODING_EUC_JP)
+  {"euc_jp", ICONV_ENCODING_EUC_JP},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  {"csunicode", ICONV_ENCODING_UCS_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  {"latin6", ICONV_ENCODING_ISO_8859_10},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  {"ucs2", ICONV_ENCODING_UCS_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_13) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_13)
+  {"iso_8859_13:1998", ICONV_ENCODING_ISO_8859_13},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  {"l4", ICONV_ENCODING_ISO_8859_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_8) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_8)
+  {"csisolatinhebrew", ICONV_ENCODING_ISO_8859_8},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_R) \
+ || defined (_ICONV_TO_ENCODING_KOI8_R)
+  {"koi8_r", ICONV_ENCODING_KOI8_R},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_R) \
+ || defined (_ICONV_TO_ENCODING_KOI8_R)
+  {"cskoi8r", ICONV_ENCODING_KOI8_R},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"iso_8859_7:1987", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"csisolatingreek", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_BIG5) \
+ || defined (_ICONV_TO_ENCODING_BIG5)
+  {"cn_big5", ICONV_ENCODING_BIG5},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  {"iso8859_4", ICONV_ENCODING_ISO_8859_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_2_INTERNAL)
+  {"ucs2internal", ICONV_ENCODING_UCS_2_INTERNAL},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP855) \
+ || defined (_ICONV_TO_ENCODING_CP855)
+  {"csibm855", ICONV_ENCODING_CP855},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"l1", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  {"ucs_2", ICONV_ENCODING_UCS_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4) \
+ || defined (_ICONV_TO_ENCODING_UCS_4)
+  {"ucs_4", ICONV_ENCODING_UCS_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"asmo_708", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  {"l6", ICONV_ENCODING_ISO_8859_10},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  {"iso_8859_2:1987", ICONV_ENCODING_ISO_8859_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"iso_ir_126", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_15) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_15)
+  {"iso885915", ICONV_ENCODING_ISO_8859_15},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  {"iso10646_ucs_2", ICONV_ENCODING_UCS_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_16BE) \
+ || defined (_ICONV_TO_ENCODING_UTF_16BE)
+  {"utf16be", ICONV_ENCODING_UTF_16BE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4) \
+ || defined (_ICONV_TO_ENCODING_UCS_4)
+  {"iso_10646_ucs_4", ICONV_ENCODING_UCS_4},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_5) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_5)
+  {"iso88595", ICONV_ENCODING_ISO_8859_5},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_WIN_1258) \
+ || defined (_ICONV_TO_ENCODING_WIN_1258)
+  {"win_1258", ICONV_ENCODING_WIN_1258},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UTF_16) \
+ || defined (_ICONV_TO_ENCODING_UTF_16)
+  {"utf_16", ICONV_ENCODING_UTF_16},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4BE) \
+ || defined (_ICONV_TO_ENCODING_UCS_4BE)
+  {"ucs_4be", ICONV_ENCODING_UCS_4BE},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1255) \
+ || defined (_ICONV_TO_ENCODING_WIN_1255)
+  {"win_1255", ICONV_ENCODING_WIN_1255},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  {"iso88594", ICONV_ENCODING_ISO_8859_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"csisolatin1", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_CP850) \
+ || defined (_ICONV_TO_ENCODING_CP850)
+  {"850", ICONV_ENCODING_CP850},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  {"iso_8859_3", ICONV_ENCODING_ISO_8859_3},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_KOI8_R) \
+ || defined (_ICONV_TO_ENCODING_KOI8_R)
+  {"koi8r", ICONV_ENCODING_KOI8_R},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_KOI8_UNI) \
+ || defined (_ICONV_TO_ENCODING_KOI8_UNI)
+  {"koi8_uni", ICONV_ENCODING_KOI8_UNI},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"iso646_us", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_4) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_4)
+  {"iso_ir_110", ICONV_ENCODING_ISO_8859_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_EUC_JP) \
+ || defined (_ICONV_TO_ENCODING_EUC_JP)
+  {"eucjp", ICONV_ENCODING_EUC_JP},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1252) \
+ || defined (_ICONV_TO_ENCODING_WIN_1252)
+  {"cp1252", ICONV_ENCODING_WIN_1252},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"ascii", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_4_INTERNAL)
+  {"ucs_4internal", ICONV_ENCODING_UCS_4_INTERNAL},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_UCS_4_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_4_INTERNAL)
+  {"ucs_4_internal", ICONV_ENCODING_UCS_4_INTERNAL},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"ansi_x3.4_1968", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  {"iso8859_3", ICONV_ENCODING_ISO_8859_3},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_8) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_8)
+  {"iso_8859_8", ICONV_ENCODING_ISO_8859_8},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_BIG5) \
+ || defined (_ICONV_TO_ENCODING_BIG5)
+  {"big5", ICONV_ENCODING_BIG5},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1254) \
+ || defined (_ICONV_TO_ENCODING_WIN_1254)
+  {"win_1254", ICONV_ENCODING_WIN_1254},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"iso8859_7", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_13) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_13)
+  {"iso885913", ICONV_ENCODING_ISO_8859_13},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_8) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_8)
+  {"iso8859_8", ICONV_ENCODING_ISO_8859_8},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_6) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_6)
+  {"iso_8859_6:1987", ICONV_ENCODING_ISO_8859_6},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_WIN_1257) \
+ || defined (_ICONV_TO_ENCODING_WIN_1257)
+  {"win_1257", ICONV_ENCODING_WIN_1257},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1250) \
+ || defined (_ICONV_TO_ENCODING_WIN_1250)
+  {"cp1250", ICONV_ENCODING_WIN_1250},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_9) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_9)
+  {"iso88599", ICONV_ENCODING_ISO_8859_9},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  {"csisolatin6", ICONV_ENCODING_ISO_8859_10},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"csascii", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"ibm367", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  {"iso_8859_10:1992", ICONV_ENCODING_ISO_8859_10},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_2) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_2)
+  {"l2", ICONV_ENCODING_ISO_8859_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP775) \
+ || defined (_ICONV_TO_ENCODING_CP775)
+  {"cp775", ICONV_ENCODING_CP775},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1255) \
+ || defined (_ICONV_TO_ENCODING_WIN_1255)
+  {"cp1255", ICONV_ENCODING_WIN_1255},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4) \
+ || defined (_ICONV_TO_ENCODING_UCS_4)
+  {"iso10646ucs4", ICONV_ENCODING_UCS_4},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP855) \
+ || defined (_ICONV_TO_ENCODING_CP855)
+  {"855", ICONV_ENCODING_CP855},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_CP850) \
+ || defined (_ICONV_TO_ENCODING_CP850)
+  {"cp850", ICONV_ENCODING_CP850},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_2) \
+ || defined (_ICONV_TO_ENCODING_UCS_2)
+  {"iso_10646_ucs2", ICONV_ENCODING_UCS_2},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_WIN_1256) \
+ || defined (_ICONV_TO_ENCODING_WIN_1256)
+  {"cp1256", ICONV_ENCODING_WIN_1256},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_CP852) \
+ || defined (_ICONV_TO_ENCODING_CP852)
+  {"852", ICONV_ENCODING_CP852},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_WIN_1251) \
+ || defined (_ICONV_TO_ENCODING_WIN_1251)
+  {"cp1251", ICONV_ENCODING_WIN_1251},
+#else
+  {NULL, NULL},
+#endif
+  {NULL, NULL},
+#if defined (_ICONV_FROM_ENCODING_ISO_IR_111) \
+ || defined (_ICONV_TO_ENCODING_ISO_IR_111)
+  {"koi8e", ICONV_ENCODING_ISO_IR_111},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_3) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_3)
+  {"latin3", ICONV_ENCODING_ISO_8859_3},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_8) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_8)
+  {"hebrew", ICONV_ENCODING_ISO_8859_8},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  {"iso_8859_10", ICONV_ENCODING_ISO_8859_10},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_7) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_7)
+  {"greek8", ICONV_ENCODING_ISO_8859_7},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_10) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_10)
+  {"iso8859_10", ICONV_ENCODING_ISO_8859_10},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"cp367", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_BIG5) \
+ || defined (_ICONV_TO_ENCODING_BIG5)
+  {"big_five", ICONV_ENCODING_BIG5},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_1) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_1)
+  {"cp819", ICONV_ENCODING_ISO_8859_1},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_US_ASCII) \
+ || defined (_ICONV_TO_ENCODING_US_ASCII)
+  {"us", ICONV_ENCODING_US_ASCII},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_UCS_4_INTERNAL) \
+ || defined (_ICONV_TO_ENCODING_UCS_4_INTERNAL)
+  {"ucs4internal", ICONV_ENCODING_UCS_4_INTERNAL},
+#else
+  {NULL, NULL},
+#endif
+#if defined (_ICONV_FROM_ENCODING_ISO_8859_15) \
+ || defined (_ICONV_TO_ENCODING_ISO_8859_15)
+  {"iso8859_15", ICONV_ENCODING_ISO_8859_15},
+#else
+  {NULL, NULL},
+#endif
+};
+
+#endif /* !__ALIASHASH_H__ */
+
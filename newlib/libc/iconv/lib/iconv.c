@@ -157,15 +157,10 @@ _iconv_open_r (struct _reent *rptr,
   if (to == NULL || from == NULL || *to == '\0' || *from == '\0')
     return (iconv_t)-1;
 
-  if ((to = (const char *)_iconv_resolve_encoding_name (rptr, to)) == NULL)
+  if ((to = _iconv_find_encoding_name (to)) == NULL
+      || (from = _iconv_find_encoding_name (from)) == NULL)
     return (iconv_t)-1;
 
-  if ((from = (const char *)_iconv_resolve_encoding_name (rptr, from)) == NULL)
-    {
-      _free_r (rptr, (void *)to);
-      return (iconv_t)-1;
-    }
-
   ic = (iconv_conversion_t *)_malloc_r (rptr, sizeof (iconv_conversion_t));
   if (ic == NULL)
     return (iconv_t)-1;
@@ -184,9 +179,6 @@ _iconv_open_r (struct _reent *rptr,
       ic->data = ic->handlers->open (rptr, to, from);
     }
 
-  _free_r (rptr, (void *)to);
-  _free_r (rptr, (void *)from);
-
   if (ic->data == NULL)
     {
       _free_r (rptr, (void *)ic);
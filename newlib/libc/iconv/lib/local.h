@@ -62,5 +62,15 @@ typedef __uint32_t ucs4_t;
 extern const char *
 _iconv_aliases;
 
+/* Slot of the perfect hash of built-in encoding names and aliases */
+typedef struct
+{
+  const char *alias; /* Name or alias in canonical form */
+  const char *name;  /* Encoding name */
+} iconv_alias_t;
+
+const char *
+_iconv_find_encoding_name (const char *ca);
+
 #endif /* !__ICONV_LIB_LOCAL_H__ */
 
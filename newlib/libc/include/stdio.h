@@ -62,6 +62,8 @@ typedef __gnuc_va_list va_list;
 
 _BEGIN_STD_C
 
+struct iovec;
+
 #if !defined(__FILE_defined)
 typedef __FILE FILE;
 # define __FILE_defined
@@ -100,6 +102,7 @@ typedef _fpos64_t fpos64_t;
 
 /* _flags2 flags */
 #define	__SNLK  0x0001		/* stdio functions do not lock streams themselves */
+#define	__SDIRTY 0x0002		/* may have buffered output, see __sflush_dirty_r */
 #define	__SWID	0x2000		/* true => stream orientation wide, false => byte, only valid if __SORD in _flags is true */
 
 /*
@@ -445,6 +448,7 @@ _off_t	_ftello_r (struct _reent *, FILE *);
 void	_rewind_r (struct _reent *, FILE *);
 size_t	_fwrite_r (struct _reent *, const void *__restrict, size_t _size, size_t _n, FILE *__restrict);
 size_t	_fwrite_unlocked_r (struct _reent *, const void *__restrict, size_t _size, size_t _n, FILE *__restrict);
+size_t	_fwritev_r (struct _reent *, FILE *__restrict, const struct iovec *, int);
 int	_getc_r (struct _reent *, FILE *);
 int	_getc_unlocked_r (struct _reent *, FILE *);
 int	_getchar_r (struct _reent *);
@@ -541,6 +545,7 @@ int	fgetc_unlocked (FILE *);
 int	fputc_unlocked (int, FILE *);
 size_t	fread_unlocked (void *__restrict, size_t _size, size_t _n, FILE *__restrict);
 size_t	fwrite_unlocked (const void *__restrict , size_t _size, size_t _n, FILE *);
+size_t	fwritev (FILE *__restrict, const struct iovec *, int);
 #endif
 
 #if __GNU_VISIBLE
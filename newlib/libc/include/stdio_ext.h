@@ -21,6 +21,8 @@ _BEGIN_STD_C
 
 void	 __fpurge (FILE *);
 int	 __fsetlocking (FILE *, int);
+int	 __fstats (FILE *, struct __sfstats *);
+int	 __fstats_total (struct __sfstats *);
 
 /* TODO:
 
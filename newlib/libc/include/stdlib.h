@@ -141,6 +141,27 @@ int	_mkstemp_r (struct _reent *, char *);
 int	_mkstemps_r (struct _reent *, char *, int);
 char *	_mktemp_r (struct _reent *, char *) _ATTRIBUTE ((__deprecated__("the use of `mktemp' is dangerous; use `mkstemp' instead")));
 void	qsort (void *__base, size_t __nmemb, size_t __size, __compar_fn_t _compar);
+#if __MISC_VISIBLE
+/* Key types for qsort_key.  */
+#define QSORT_KEY_U32	0
+#define QSORT_KEY_S32	1
+#define QSORT_KEY_U64	2
+#define QSORT_KEY_S64	3
+#define QSORT_KEY_F32	4
+#define QSORT_KEY_F64	5
+int	qsort_key (void *__base, size_t __nmemb, size_t __size,
+		   size_t __offset, int __type);
+
+typedef struct __bsearch_index bsearch_index_t;
+bsearch_index_t *bsearch_index_build (const void *__base, size_t __nmemb,
+		   size_t __size, __compar_fn_t _compar);
+bsearch_index_t *bsearch_index_build_key (const void *__base, size_t __nmemb,
+		   size_t __size, size_t __offset, int __type);
+void *	bsearch_index (const void *__key, const bsearch_index_t *__idx);
+void	bsearch_index_batch (const bsearch_index_t *__idx, const void *__keys,
+		   size_t __nkeys, size_t __ksize, void **__results);
+void	bsearch_index_free (bsearch_index_t *__idx);
+#endif
 int	rand (void);
 void	*realloc(void *, size_t) __result_use_check __alloc_size(2) _NOTHROW;
 #if __BSD_VISIBLE
@@ -0,0 +1,87 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Static probe points inside the library.
+
+   _LIBC_PROBE (name, n, arg1, ..., argn) marks a location in the
+   library code.  When newlib is configured with
+   --enable-newlib-sdt-probes and built for an ELF target with GCC, each
+   probe emits a single nop plus a SystemTap-compatible .note.stapsdt
+   entry with provider "newlib", so perf, bpftrace and systemtap can
+   attach to it without rebuilding.  Otherwise the macro expands to
+   nothing.  At most three integer or pointer arguments are supported;
+   they are described to the tracer as unsigned values of their natural
+   size.
+
+   _LIBC_PROBE_EXPR (expr, name, n, arg1, ..., argn) fires the probe and
+   then yields the value of EXPR, for use in macros that must remain
+   expressions.  */
+
+#ifndef _SYS__SDT_H_
+#define _SYS__SDT_H_
+
+#include <newlib.h>
+
+#if defined (_NEWLIB_SDT_PROBES) && defined (__ELF__) && defined (__GNUC__)
+
+#if __SIZEOF_POINTER__ == 8
+#define _SDT_ASM_ADDR ".8byte"
+#else
+#define _SDT_ASM_ADDR ".4byte"
+#endif
+
+#define _SDT_STR(x) #x
+
+#define _SDT_NOTE(name, args)						\
+  "990:	nop\n"								\
+  "	.pushsection .note.stapsdt,\"\",\"note\"\n"			\
+  "	.balign 4\n"							\
+  "	.4byte 992f-991f, 994f-993f, 3\n"				\
+  "991:	.asciz \"stapsdt\"\n"						\
+  "992:	.balign 4\n"							\
+  "993:	" _SDT_ASM_ADDR " 990b\n"					\
+  "	" _SDT_ASM_ADDR " _.stapsdt.base\n"				\
+  "	" _SDT_ASM_ADDR " 0\n"						\
+  "	.asciz \"newlib\"\n"						\
+  "	.asciz \"" _SDT_STR (name) "\"\n"				\
+  "	.asciz \"" args "\"\n"						\
+  "994:	.balign 4\n"							\
+  "	.popsection\n"							\
+  "	.ifndef _.stapsdt.base\n"					\
+  "	.pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+  "	.weak _.stapsdt.base\n"						\
+  "	.hidden _.stapsdt.base\n"					\
+  "_.stapsdt.base: .space 1\n"						\
+  "	.size _.stapsdt.base, 1\n"					\
+  "	.popsection\n"							\
+  "	.endif\n"
+
+#define _SDT_OP(n, x) [_sdt_s##n] "n" (sizeof (x)), [_sdt_a##n] "nor" (x)
+#define _SDT_ARG(n) "%c[_sdt_s" #n "]@%[_sdt_a" #n "]"
+
+#define _LIBC_PROBE_0(name)						\
+  __asm__ __volatile__ (_SDT_NOTE (name, ""))
+#define _LIBC_PROBE_1(name, a1)						\
+  __asm__ __volatile__ (_SDT_NOTE (name, _SDT_ARG (1))			\
+			: : _SDT_OP (1, a1))
+#define _LIBC_PROBE_2(name, a1, a2)					\
+  __asm__ __volatile__ (_SDT_NOTE (name, _SDT_ARG (1) " " _SDT_ARG (2))	\
+			: : _SDT_OP (1, a1), _SDT_OP (2, a2))
+#define _LIBC_PROBE_3(name, a1, a2, a3)					\
+  __asm__ __volatile__ (_SDT_NOTE (name, _SDT_ARG (1) " " _SDT_ARG (2)	\
+				   " " _SDT_ARG (3))			\
+			: : _SDT_OP (1, a1), _SDT_OP (2, a2), _SDT_OP (3, a3))
+
+#define _LIBC_PROBE(name, n, ...) _LIBC_PROBE_##n (name, ##__VA_ARGS__)
+#define _LIBC_PROBE_EXPR(expr, name, n, ...)				\
+  __extension__ ({ _LIBC_PROBE (name, n, ##__VA_ARGS__); (expr); })
+
+#else
+
+#define _LIBC_PROBE(name, n, ...) ((void) 0)
+#define _LIBC_PROBE_EXPR(expr, name, n, ...) (expr)
+
+#endif
+
+#endif /* _SYS__SDT_H_ */
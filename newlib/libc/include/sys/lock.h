@@ -5,6 +5,7 @@
 
 #include <newlib.h>
 #include <_ansi.h>
+#include <sys/_sdt.h>
 
 #if !defined(_RETARGETABLE_LOCKING)
 
@@ -46,19 +47,30 @@ extern void __retarget_lock_close(_LOCK_T lock);
 #define __lock_close(lock) __retarget_lock_close(lock)
 extern void __retarget_lock_close_recursive(_LOCK_T lock);
 #define __lock_close_recursive(lock) __retarget_lock_close_recursive(lock)
+/* The probes sit here rather than in the default __retarget_lock_*
+   routines, so that they survive a target supplying its own.  */
 extern void __retarget_lock_acquire(_LOCK_T lock);
-#define __lock_acquire(lock) __retarget_lock_acquire(lock)
+#define __lock_acquire(lock) \
+  _LIBC_PROBE_EXPR (__retarget_lock_acquire(lock), lock_acquire, 1, lock)
 extern void __retarget_lock_acquire_recursive(_LOCK_T lock);
-#define __lock_acquire_recursive(lock) __retarget_lock_acquire_recursive(lock)
+#define __lock_acquire_recursive(lock) \
+  _LIBC_PROBE_EXPR (__retarget_lock_acquire_recursive(lock), \
+		    lock_acquire, 1, lock)
 extern int __retarget_lock_try_acquire(_LOCK_T lock);
-#define __lock_try_acquire(lock) __retarget_lock_try_acquire(lock)
+#define __lock_try_acquire(lock) \
+  _LIBC_PROBE_EXPR (__retarget_lock_try_acquire(lock), \
+		    lock_try_acquire, 1, lock)
 extern int __retarget_lock_try_acquire_recursive(_LOCK_T lock);
 #define __lock_try_acquire_recursive(lock) \
-  __retarget_lock_try_acquire_recursive(lock)
+  _LIBC_PROBE_EXPR (__retarget_lock_try_acquire_recursive(lock), \
+		    lock_try_acquire, 1, lock)
 extern void __retarget_lock_release(_LOCK_T lock);
-#define __lock_release(lock) __retarget_lock_release(lock)
+#define __lock_release(lock) \
+  _LIBC_PROBE_EXPR (__retarget_lock_release(lock), lock_release, 1, lock)
 extern void __retarget_lock_release_recursive(_LOCK_T lock);
-#define __lock_release_recursive(lock) __retarget_lock_release_recursive(lock)
+#define __lock_release_recursive(lock) \
+  _LIBC_PROBE_EXPR (__retarget_lock_release_recursive(lock), \
+		    lock_release, 1, lock)
 
 #ifdef __cplusplus
 }
@@ -183,6 +183,19 @@ extern void   __sinit (struct _reent *);
 # define _REENT_SMALL_CHECK_INIT(ptr) /* nothing */
 #endif /* _REENT_SMALL && !_REENT_GLOBAL_STDIO_STREAMS */
 
+/* Per-stream I/O statistics, see __fstats in <stdio_ext.h>.  Only kept
+   in the FILE structure if newlib is configured with
+   --enable-newlib-stdio-stats.  */
+struct __sfstats {
+  unsigned long _bytes_read;	/* bytes delivered by the read function */
+  unsigned long _bytes_written;	/* bytes accepted by the write function */
+  unsigned long _reads;		/* read function calls (__srefill_r) */
+  unsigned long _writes;	/* write function calls (__sflush_r, fvwrite) */
+  unsigned long _seeks;		/* fseek/fseeko/rewind requests */
+  unsigned long _buf_resizes;	/* buffer allocations and reallocations */
+  unsigned long _locks;		/* stream lock acquisitions */
+};
+
 struct __sFILE {
   unsigned char *_p;	/* current position in (some) buffer */
   int	_r;		/* read space left for getc() */
@@ -232,6 +245,9 @@ struct __sFILE {
 #endif
   _mbstate_t _mbstate;	/* for wide char stdio functions. */
   int   _flags2;        /* for future use */
+#ifdef _WANT_STDIO_STATS
+  struct __sfstats _stats;	/* I/O statistics */
+#endif
 };
 
 #ifdef __CUSTOM_FILE_IO__
@@ -286,6 +302,9 @@ struct __sFILE64 {
   _flock_t _lock;	/* for thread-safety locking */
 #endif
   _mbstate_t _mbstate;	/* for wide char stdio functions. */
+#ifdef _WANT_STDIO_STATS
+  struct __sfstats _stats;	/* I/O statistics */
+#endif
 };
 typedef struct __sFILE64 __FILE;
 #else
@@ -370,6 +389,7 @@ struct _misc_reent
   _mbstate_t _mbsrtowcs_state;
   _mbstate_t _wcrtomb_state;
   _mbstate_t _wcsrtombs_state;
+  int _h_errno;
 };
 
 /* This version of _reent is laid out with "int"s in pairs, to help
@@ -576,6 +596,7 @@ extern const struct __sFILE_fake __sf_fake_stderr;
   _r->_misc->_wcsrtombs_state.__value.__wch = 0; \
   _r->_misc->_l64a_buf[0] = '\0'; \
   _r->_misc->_getdate_err = 0; \
+  _r->_misc->_h_errno = 0; \
 } while (0)
 #define _REENT_CHECK_MISC(var) \
   _REENT_CHECK(var, _misc, struct _misc_reent *, sizeof *((var)->_misc), _REENT_INIT_MISC(var))
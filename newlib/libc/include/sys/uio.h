@@ -0,0 +1,28 @@
+#ifndef	_SYS_UIO_H_
+#define	_SYS_UIO_H_
+
+#include <_ansi.h>
+#include <sys/cdefs.h>
+#include <sys/types.h>
+
+_BEGIN_STD_C
+
+/* Scatter/gather vector used by fwritev, and by readv and writev where
+   the target provides them.  Targets with their own kernel ABI install a
+   replacement of this header.  */
+struct iovec {
+	void	*iov_base;	/* base address of the fragment */
+	size_t	 iov_len;	/* length of the fragment */
+};
+
+/* Most targets have no readv or writev; only declare them where the
+   system layer implements them, so that configure checks do not find
+   functions which fail to link.  */
+#ifdef __linux__
+ssize_t readv (int, const struct iovec *, int);
+ssize_t writev (int, const struct iovec *, int);
+#endif
+
+_END_STD_C
+
+#endif	/* !_SYS_UIO_H_ */
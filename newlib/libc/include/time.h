@@ -96,6 +96,13 @@ char      *strptime (const char *__restrict,
 char *strptime_l (const char *__restrict, const char *__restrict,
 		  struct tm *__restrict, locale_t);
 #endif
+#if __MISC_VISIBLE
+typedef struct __strptime_format strptime_format_t;
+strptime_format_t *strptime_compile (const char *__restrict, locale_t);
+char *strptime_exec (const char *__restrict, const strptime_format_t *,
+		     struct tm *__restrict);
+void strptime_format_free (strptime_format_t *);
+#endif
 
 #if __POSIX_VISIBLE
 void      tzset 	(void);
@@ -0,0 +1,74 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* memmem with a NEON candidate filter.  Each step compares the first
+   and the last byte of the needle against 16 consecutive haystack
+   positions; only positions where both match are verified with memcmp.
+   If verification does too much work, the rest of the haystack is
+   searched by the generic, linear-time implementation.  */
+
+#include <string.h>
+
+#if defined(PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__) \
+    || defined(__AARCH64EB__)
+# include "../../string/memmem.c"
+#else
+
+#include <stdint.h>
+#include <arm_neon.h>
+
+/* Reduce the result of a byte comparison to a 64-bit mask with four
+   bits per byte.  */
+static inline uint64_t
+match_mask (uint8x16_t eq)
+{
+  uint8x8_t m = vshrn_n_u16 (vreinterpretq_u16_u8 (eq), 4);
+
+  return vget_lane_u64 (vreinterpret_u64_u8 (m), 0);
+}
+
+#define memmem __memmem_generic
+#include "../../string/memmem.c"
+#undef memmem
+
+/* Bytes of failed verification allowed beyond the number of haystack
+   positions scanned before falling back to the generic search.  */
+#define VERIFY_SLACK 256
+
+void *
+memmem (const void *haystack, size_t hs_len, const void *needle, size_t ne_len)
+{
+  const unsigned char *hs = (const unsigned char *) haystack;
+  const unsigned char *ne = (const unsigned char *) needle;
+  size_t i, work = 0;
+  uint8x16_t first, last;
+
+  if (ne_len < 2 || hs_len < ne_len + 15)
+    return __memmem_generic (haystack, hs_len, needle, ne_len);
+
+  first = vdupq_n_u8 (ne[0]);
+  last = vdupq_n_u8 (ne[ne_len - 1]);
+  for (i = 0; i + ne_len + 15 <= hs_len; i += 16)
+    {
+      uint8x16_t a = vld1q_u8 (hs + i);
+      uint8x16_t b = vld1q_u8 (hs + i + ne_len - 1);
+      uint64_t mask;
+
+      mask = match_mask (vandq_u8 (vceqq_u8 (a, first), vceqq_u8 (b, last)));
+      while (mask != 0)
+	{
+	  size_t j = __builtin_ctzll (mask) >> 2;
+
+	  if (memcmp (hs + i + j + 1, ne + 1, ne_len - 2) == 0)
+	    return (void *) (hs + i + j);
+	  work += ne_len;
+	  mask &= ~((uint64_t) 0xf << (j * 4));
+	}
+      if (work > i + VERIFY_SLACK)
+	break;
+    }
+  return __memmem_generic (hs + i, hs_len - i, ne, ne_len);
+}
+
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ && !__AARCH64EB__ */
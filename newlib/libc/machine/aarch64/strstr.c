@@ -0,0 +1,84 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* strstr with a NEON candidate filter, see memmem.c.  The haystack
+   length is discovered in chunks with strnlen, so that no load reaches
+   past the terminating NUL.  */
+
+#include <string.h>
+#include <limits.h>
+
+#if defined(PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__) \
+    || defined(__AARCH64EB__) || CHAR_BIT > 8
+# include "../../string/strstr.c"
+#else
+
+#include <stdint.h>
+#include <arm_neon.h>
+
+/* Reduce the result of a byte comparison to a 64-bit mask with four
+   bits per byte.  */
+static inline uint64_t
+match_mask (uint8x16_t eq)
+{
+  uint8x8_t m = vshrn_n_u16 (vreinterpretq_u16_u8 (eq), 4);
+
+  return vget_lane_u64 (vreinterpret_u64_u8 (m), 0);
+}
+
+#define strstr __strstr_generic
+#include "../../string/strstr.c"
+#undef strstr
+
+/* Bytes of failed verification allowed beyond the number of haystack
+   positions scanned before falling back to the generic search.  */
+#define VERIFY_SLACK 256
+
+char *
+strstr (const char *haystack, const char *needle)
+{
+  const unsigned char *hs = (const unsigned char *) haystack;
+  const unsigned char *ne = (const unsigned char *) needle;
+  size_t ne_len, hs_len = 0, i, n, work = 0;
+  uint8x16_t first, last;
+
+  if (ne[0] == '\0' || ne[1] == '\0')
+    return __strstr_generic (haystack, needle);
+
+  ne_len = strlen (needle);
+  first = vdupq_n_u8 (ne[0]);
+  last = vdupq_n_u8 (ne[ne_len - 1]);
+  for (i = 0; ; i += 16)
+    {
+      uint8x16_t a, b;
+      uint64_t mask;
+
+      /* Both loads must stay within the known part of the haystack.  */
+      while (i + ne_len + 15 > hs_len)
+	{
+	  n = strnlen (haystack + hs_len, 2048);
+	  if (n == 0)
+	    return __strstr_generic (haystack + i, needle);
+	  hs_len += n;
+	}
+
+      a = vld1q_u8 (hs + i);
+      b = vld1q_u8 (hs + i + ne_len - 1);
+      mask = match_mask (vandq_u8 (vceqq_u8 (a, first), vceqq_u8 (b, last)));
+      while (mask != 0)
+	{
+	  size_t j = __builtin_ctzll (mask) >> 2;
+
+	  if (memcmp (hs + i + j + 1, ne + 1, ne_len - 2) == 0)
+	    return (char *) (hs + i + j);
+	  work += ne_len;
+	  mask &= ~((uint64_t) 0xf << (j * 4));
+	}
+      if (work > i + VERIFY_SLACK)
+	return __strstr_generic (haystack + i, needle);
+    }
+}
+
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ && !__AARCH64EB__
+	  && CHAR_BIT <= 8 */
@@ -0,0 +1,16 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* The structure of the following #if #else #endif conditional chain
+   must match the chain in memset.S.  */
+
+#include "acle-compat.h"
+
+#if defined (__OPTIMIZE_SIZE__) || defined (PREFER_SIZE_OVER_SPEED)
+# include "../../string/memset.c"
+#elif defined (__ARM_FEATURE_MVE)
+/* Defined in memset.S.  */
+#else
+# include "../../string/memset.c"
+#endif
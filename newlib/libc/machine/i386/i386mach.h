@@ -68,6 +68,11 @@
 #define mm6 REG(mm6)
 #define mm7 REG(mm7)
 
+#define xmm0 REG(xmm0)
+#define xmm1 REG(xmm1)
+#define xmm2 REG(xmm2)
+#define xmm3 REG(xmm3)
+
 #ifdef _I386MACH_NEED_SOTYPE_FUNCTION
 #define SOTYPE_FUNCTION(sym) .type SYM(sym),@function
 #else
@@ -81,3 +86,42 @@
 #define __CLI  cli
 #define __STI  sti
 #endif
+
+/* The string functions have SSE2 versions that are selected at run
+   time with cpuid.  They need an operating system that saves the SSE
+   state, so targets other than Linux must opt in by defining
+   _I386MACH_ALLOW_SSE2.  */
+#if !defined (__iamcu__) && !defined (__OPTIMIZE_SIZE__) \
+    && (defined (__linux__) || defined (_I386MACH_ALLOW_SSE2))
+#define _I386MACH_SSE2 1
+#endif
+
+#ifdef _I386MACH_SSE2
+/* __i386_sse2 is zero until __i386_sse2_init has run, then positive if
+   the processor supports SSE2 and negative otherwise.  */
+#ifdef __PIC__
+#define SSE2_LOAD_FLAG						\
+	call	8f;						\
+8:	popl	ecx;						\
+	addl	$_GLOBAL_OFFSET_TABLE_+[.-8b],ecx;		\
+	movl	SYM (__i386_sse2)@GOTOFF(ecx),eax
+#else
+#define SSE2_LOAD_FLAG						\
+	movl	SYM (__i386_sse2),eax
+#endif
+
+/* Jump to LABEL if the processor supports SSE2.  Used on entry of a
+   function, where only the stack holds arguments; clobbers eax, ecx
+   and edx.  */
+#define SSE2_DISPATCH(label)					\
+	SSE2_LOAD_FLAG;						\
+	testl	eax,eax;					\
+	jg	label;						\
+	jl	9f;						\
+	call	SYM (__i386_sse2_init);				\
+	testl	eax,eax;					\
+	jg	label;						\
+9:
+#else
+#define SSE2_DISPATCH(label)
+#endif
@@ -0,0 +1,13 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* The following condition must match the one that defines
+   _I386MACH_SSE2 in i386mach.h.  */
+
+#if !defined (__iamcu__) && !defined (__OPTIMIZE_SIZE__) \
+    && (defined (__linux__) || defined (_I386MACH_ALLOW_SSE2))
+/* Defined in strcmp.S.  */
+#else
+# include "../../string/strcmp.c"
+#endif
@@ -0,0 +1,63 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* memmem with an SSE2 candidate filter.  Each step compares the first
+   and the last byte of the needle against 16 consecutive haystack
+   positions; only positions where both match are verified with memcmp.
+   If verification does too much work, the rest of the haystack is
+   searched by the generic, linear-time implementation.  */
+
+#include <string.h>
+
+#if defined(PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__)
+# include "../../string/memmem.c"
+#else
+
+#include <emmintrin.h>
+
+#define memmem __memmem_generic
+#include "../../string/memmem.c"
+#undef memmem
+
+/* Bytes of failed verification allowed beyond the number of haystack
+   positions scanned before falling back to the generic search.  */
+#define VERIFY_SLACK 256
+
+void *
+memmem (const void *haystack, size_t hs_len, const void *needle, size_t ne_len)
+{
+  const unsigned char *hs = (const unsigned char *) haystack;
+  const unsigned char *ne = (const unsigned char *) needle;
+  size_t i, work = 0;
+  __m128i first, last;
+
+  if (ne_len < 2 || hs_len < ne_len + 15)
+    return __memmem_generic (haystack, hs_len, needle, ne_len);
+
+  first = _mm_set1_epi8 (ne[0]);
+  last = _mm_set1_epi8 (ne[ne_len - 1]);
+  for (i = 0; i + ne_len + 15 <= hs_len; i += 16)
+    {
+      __m128i a = _mm_loadu_si128 ((const __m128i *) (hs + i));
+      __m128i b = _mm_loadu_si128 ((const __m128i *) (hs + i + ne_len - 1));
+      unsigned int mask;
+
+      mask = _mm_movemask_epi8 (_mm_and_si128 (_mm_cmpeq_epi8 (a, first),
+					       _mm_cmpeq_epi8 (b, last)));
+      while (mask != 0)
+	{
+	  size_t j = __builtin_ctz (mask);
+
+	  if (memcmp (hs + i + j + 1, ne + 1, ne_len - 2) == 0)
+	    return (void *) (hs + i + j);
+	  work += ne_len;
+	  mask &= mask - 1;
+	}
+      if (work > i + VERIFY_SLACK)
+	break;
+    }
+  return __memmem_generic (hs + i, hs_len - i, ne, ne_len);
+}
+
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ */
@@ -0,0 +1,73 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* strstr with an SSE2 candidate filter, see memmem.c.  The haystack
+   length is discovered in chunks with strnlen, so that no load reaches
+   past the terminating NUL.  */
+
+#include <string.h>
+#include <limits.h>
+
+#if defined(PREFER_SIZE_OVER_SPEED) || defined(__OPTIMIZE_SIZE__) \
+    || CHAR_BIT > 8
+# include "../../string/strstr.c"
+#else
+
+#include <emmintrin.h>
+
+#define strstr __strstr_generic
+#include "../../string/strstr.c"
+#undef strstr
+
+/* Bytes of failed verification allowed beyond the number of haystack
+   positions scanned before falling back to the generic search.  */
+#define VERIFY_SLACK 256
+
+char *
+strstr (const char *haystack, const char *needle)
+{
+  const unsigned char *hs = (const unsigned char *) haystack;
+  const unsigned char *ne = (const unsigned char *) needle;
+  size_t ne_len, hs_len = 0, i, n, work = 0;
+  __m128i first, last;
+
+  if (ne[0] == '\0' || ne[1] == '\0')
+    return __strstr_generic (haystack, needle);
+
+  ne_len = strlen (needle);
+  first = _mm_set1_epi8 (ne[0]);
+  last = _mm_set1_epi8 (ne[ne_len - 1]);
+  for (i = 0; ; i += 16)
+    {
+      __m128i a, b;
+      unsigned int mask;
+
+      /* Both loads must stay within the known part of the haystack.  */
+      while (i + ne_len + 15 > hs_len)
+	{
+	  n = strnlen (haystack + hs_len, 2048);
+	  if (n == 0)
+	    return __strstr_generic (haystack + i, needle);
+	  hs_len += n;
+	}
+
+      a = _mm_loadu_si128 ((const __m128i *) (hs + i));
+      b = _mm_loadu_si128 ((const __m128i *) (hs + i + ne_len - 1));
+      mask = _mm_movemask_epi8 (_mm_and_si128 (_mm_cmpeq_epi8 (a, first),
+					       _mm_cmpeq_epi8 (b, last)));
+      while (mask != 0)
+	{
+	  size_t j = __builtin_ctz (mask);
+
+	  if (memcmp (hs + i + j + 1, ne + 1, ne_len - 2) == 0)
+	    return (char *) (hs + i + j);
+	  work += ne_len;
+	  mask &= mask - 1;
+	}
+      if (work > i + VERIFY_SLACK)
+	return __strstr_generic (haystack + i, needle);
+    }
+}
+
+#endif /* !PREFER_SIZE_OVER_SPEED && !__OPTIMIZE_SIZE__ && CHAR_BIT <= 8 */
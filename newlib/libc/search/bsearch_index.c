@@ -0,0 +1,361 @@
+/*
+ * This file is in the public domain.
+ */
+/*
+FUNCTION
+<<bsearch_index>>---repeated search in a sorted array
+
+INDEX
+	bsearch_index_build
+INDEX
+	bsearch_index_build_key
+INDEX
+	bsearch_index
+INDEX
+	bsearch_index_batch
+INDEX
+	bsearch_index_free
+
+SYNOPSIS
+	#include <stdlib.h>
+	bsearch_index_t *bsearch_index_build(const void *<[base]>,
+		size_t <[nmemb]>, size_t <[size]>,
+		int (*<[compar]>)(const void *, const void *));
+	bsearch_index_t *bsearch_index_build_key(const void *<[base]>,
+		size_t <[nmemb]>, size_t <[size]>,
+		size_t <[offset]>, int <[type]>);
+	void *bsearch_index(const void *<[key]>,
+		const bsearch_index_t *<[idx]>);
+	void bsearch_index_batch(const bsearch_index_t *<[idx]>,
+		const void *<[keys]>, size_t <[nkeys]>, size_t <[ksize]>,
+		void **<[results]>);
+	void bsearch_index_free(bsearch_index_t *<[idx]>);
+
+DESCRIPTION
+These functions speed up many <<bsearch>> calls on the same sorted
+array.  <<bsearch_index_build>> takes the arguments of <<bsearch>>
+except the key and returns an index holding a copy of the <[nmemb]>
+elements of <[base]> in Eytzinger (breadth first) order.  The first
+levels of this implicit search tree share a few cache lines, and the
+children of a node are adjacent, so the descent can prefetch several
+levels ahead instead of waiting for each probe.
+
+<<bsearch_index_build_key>> builds an index for an array sorted in
+ascending order of a numeric key at byte offset <[offset]> of each
+element, with <[type]> one of the <<QSORT_KEY_>> constants described
+for <<qsort_key>>.  Searches in such an index call no comparison
+function and select the next node without a branch.  The keys passed
+to the search functions are then values of the key type, not
+elements.  Floating point keys require IEEE 754 formats.
+
+<<bsearch_index>> returns a pointer to the first element of the
+original array that matches <[key]>, or <<NULL>>.  <[base]> must stay
+valid and unchanged while the index is in use.
+
+<<bsearch_index_batch>> searches the <[nkeys]> keys stored <[ksize]>
+bytes apart at <[keys]> and stores the result for each of them into
+<[results]>.  Several keys descend the tree in lockstep, so that the
+cache misses of independent searches overlap.
+
+<<bsearch_index_free>> releases the index.
+
+RETURNS
+<<bsearch_index_build>> and <<bsearch_index_build_key>> return
+<<NULL>> and set <<errno>> if the index cannot be allocated
+(<<ENOMEM>>) or the key description is invalid (<<EINVAL>>).
+
+PORTABILITY
+These functions are newlib extensions.
+
+Supporting OS subroutines required: <<sbrk>>.
+*/
+
+#include <_ansi.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include "sortkey.h"
+
+#ifdef __GNUC__
+#define PREFETCH(p) __builtin_prefetch (p)
+#else
+#define PREFETCH(p) ((void) 0)
+#endif
+
+/* Number of keys that bsearch_index_batch moves through the tree
+   together.  */
+#define BATCH 16
+
+struct __bsearch_index
+{
+  const char *base;
+  size_t nmemb;
+  size_t size;
+  int (*compar) (const void *, const void *);
+  int type;
+  /* Node k of the tree, 1 <= k <= nmemb, is element order[k] of
+     base.  Either elems or keys holds the copy in tree order.  */
+  size_t *order;
+  char *elems;
+  uint64_t *keys;
+};
+
+/* Assign the sorted elements starting with I to the subtree rooted
+   at K, in order.  The recursion is as deep as the tree.  */
+static size_t
+layout (size_t *order,
+	size_t n,
+	size_t i,
+	size_t k)
+{
+  if (k <= n)
+    {
+      i = layout (order, n, i, 2 * k);
+      order[k] = i++;
+      i = layout (order, n, i, 2 * k + 1);
+    }
+  return i;
+}
+
+/* A descent ends below a leaf, after a run of right turns that follow
+   the last left turn; that left turn was taken at the result.  */
+static inline size_t
+finish (size_t k)
+{
+#ifdef __GNUC__
+  return k >> (__builtin_ctzll (~(unsigned long long) k) + 1);
+#else
+  while (k & 1)
+    k >>= 1;
+  return k >> 1;
+#endif
+}
+
+static bsearch_index_t *
+index_alloc (const void *base,
+	size_t nmemb,
+	size_t size)
+{
+  bsearch_index_t *idx;
+
+  if (nmemb >= SIZE_MAX / sizeof (size_t) - 1)
+    {
+      errno = ENOMEM;
+      return NULL;
+    }
+  idx = calloc (1, sizeof (*idx));
+  if (idx == NULL)
+    return NULL;
+  idx->base = base;
+  idx->nmemb = nmemb;
+  idx->size = size;
+  idx->type = -1;
+  idx->order = malloc ((nmemb + 1) * sizeof (size_t));
+  if (idx->order == NULL)
+    {
+      free (idx);
+      return NULL;
+    }
+  layout (idx->order, nmemb, 0, 1);
+  return idx;
+}
+
+bsearch_index_t *
+bsearch_index_build (const void *base,
+	size_t nmemb,
+	size_t size,
+	int (*compar) (const void *, const void *))
+{
+  bsearch_index_t *idx;
+  size_t k;
+
+  if (size == 0 || nmemb >= SIZE_MAX / size - 1)
+    {
+      errno = size == 0 ? EINVAL : ENOMEM;
+      return NULL;
+    }
+  idx = index_alloc (base, nmemb, size);
+  if (idx == NULL)
+    return NULL;
+  idx->compar = compar;
+  idx->elems = malloc ((nmemb + 1) * size);
+  if (idx->elems == NULL)
+    {
+      bsearch_index_free (idx);
+      return NULL;
+    }
+  for (k = 1; k <= nmemb; k++)
+    memcpy (idx->elems + k * size, idx->base + idx->order[k] * size, size);
+  return idx;
+}
+
+bsearch_index_t *
+bsearch_index_build_key (const void *base,
+	size_t nmemb,
+	size_t size,
+	size_t offset,
+	int type)
+{
+  bsearch_index_t *idx;
+  size_t keysize, k;
+
+  switch (type)
+    {
+    case QSORT_KEY_U32:
+    case QSORT_KEY_S32:
+#ifdef IEEE_FLOAT
+    case QSORT_KEY_F32:
+#endif
+      keysize = 4;
+      break;
+    case QSORT_KEY_U64:
+    case QSORT_KEY_S64:
+#ifdef IEEE_DOUBLE
+    case QSORT_KEY_F64:
+#endif
+      keysize = 8;
+      break;
+    default:
+      errno = EINVAL;
+      return NULL;
+    }
+  if (size < keysize || offset > size - keysize)
+    {
+      errno = EINVAL;
+      return NULL;
+    }
+  idx = index_alloc (base, nmemb, size);
+  if (idx == NULL)
+    return NULL;
+  idx->type = type;
+  idx->keys = malloc ((nmemb + 1) * sizeof (uint64_t));
+  if (idx->keys == NULL)
+    {
+      bsearch_index_free (idx);
+      return NULL;
+    }
+  idx->keys[0] = 0;
+  for (k = 1; k <= nmemb; k++)
+    idx->keys[k] = __get_sortkey (idx->base + idx->order[k] * size,
+				  offset, type);
+  return idx;
+}
+
+void
+bsearch_index_free (bsearch_index_t *idx)
+{
+  if (idx == NULL)
+    return;
+  free (idx->order);
+  free (idx->elems);
+  free (idx->keys);
+  free (idx);
+}
+
+static inline void *
+result (const bsearch_index_t *idx,
+	size_t k)
+{
+  return (void *) (idx->base + idx->order[k] * idx->size);
+}
+
+static void *
+search_key (const bsearch_index_t *idx,
+	uint64_t key)
+{
+  const uint64_t *keys = idx->keys;
+  size_t n = idx->nmemb;
+  size_t k = 1;
+
+  while (k <= n)
+    {
+      /* The eight great-grandchildren of k share one cache line.  */
+      PREFETCH (keys + 8 * k);
+      k = 2 * k + (keys[k] < key);
+    }
+  k = finish (k);
+  return k != 0 && keys[k] == key ? result (idx, k) : NULL;
+}
+
+static void *
+search_cmp (const bsearch_index_t *idx,
+	const void *key)
+{
+  const char *elems = idx->elems;
+  size_t n = idx->nmemb;
+  size_t size = idx->size;
+  size_t k = 1;
+
+  while (k <= n)
+    {
+      PREFETCH (elems + 4 * k * size);
+      k = 2 * k + (idx->compar (key, elems + k * size) > 0);
+    }
+  k = finish (k);
+  return k != 0 && idx->compar (key, elems + k * size) == 0
+	 ? result (idx, k) : NULL;
+}
+
+void *
+bsearch_index (const void *key,
+	const bsearch_index_t *idx)
+{
+  if (idx->keys != NULL)
+    return search_key (idx, __get_sortkey (key, 0, idx->type));
+  return search_cmp (idx, key);
+}
+
+void
+bsearch_index_batch (const bsearch_index_t *idx,
+	const void *keys,
+	size_t nkeys,
+	size_t ksize,
+	void **results)
+{
+  const char *kp = keys;
+  const uint64_t *tree = idx->keys;
+  size_t n = idx->nmemb;
+  size_t i, j, m, d, depth;
+  size_t k[BATCH];
+  uint64_t key[BATCH];
+
+  if (tree == NULL)
+    {
+      for (i = 0; i < nkeys; i++, kp += ksize)
+	results[i] = search_cmp (idx, kp);
+      return;
+    }
+
+  /* Every descent takes depth or depth - 1 steps.  */
+  for (depth = 0, m = n; m != 0; m >>= 1)
+    depth++;
+
+  for (i = 0; i < nkeys; i += m)
+    {
+      m = nkeys - i < BATCH ? nkeys - i : BATCH;
+      for (j = 0; j < m; j++, kp += ksize)
+	{
+	  key[j] = __get_sortkey (kp, 0, idx->type);
+	  k[j] = 1;
+	}
+      for (d = 0; d < depth; d++)
+	for (j = 0; j < m; j++)
+	  {
+	    size_t kj = k[j];
+
+	    if (kj <= n)
+	      {
+		PREFETCH (tree + 8 * kj);
+		k[j] = 2 * kj + (tree[kj] < key[j]);
+	      }
+	  }
+      for (j = 0; j < m; j++)
+	{
+	  size_t kj = finish (k[j]);
+
+	  results[i + j] = kj != 0 && tree[kj] == key[j]
+			   ? result (idx, kj) : NULL;
+	}
+    }
+}
@@ -56,6 +56,8 @@ int	 __split_page(HTAB *, __uint32_t, __uint32_t);
 
 /* Default hash routine. */
 extern __uint32_t (*__default_hash)(const void *, size_t);
+/* Default hash routine of databases created before HASHVERSION 3. */
+extern __uint32_t (*__compat_hash)(const void *, size_t);
 
 #ifdef HASH_STATISTICS
 extern int hash_accesses, hash_collisions, hash_expansions, hash_overflows;
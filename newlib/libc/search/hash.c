@@ -168,11 +168,6 @@ __hash_open (const char *file,
 			RETURN_ERROR(errno, error1);
 	} else {
 		/* Table already exists */
-		if (info && info->hash)
-			hashp->hash = info->hash;
-		else
-			hashp->hash = __default_hash;
-
 		hdrsize = read(hashp->fp, &hashp->hdr, sizeof(HASHHDR));
 #if (BYTE_ORDER == LITTLE_ENDIAN)
 		swap_header(hashp);
@@ -185,9 +180,21 @@ __hash_open (const char *file,
 		if (hashp->MAGIC != HASHMAGIC)
 			RETURN_ERROR(EFTYPE, error1);
 #define	OLDHASHVERSION	1
+#define	HASH4VERSION	2
 		if (hashp->HASH_VERSION != HASHVERSION &&
+		    hashp->HASH_VERSION != HASH4VERSION &&
 		    hashp->HASH_VERSION != OLDHASHVERSION)
 			RETURN_ERROR(EFTYPE, error1);
+		/*
+		 * Tables of older versions were created with hash4 as the
+		 * default; h_charkey below catches a wrong guess.
+		 */
+		if (info && info->hash)
+			hashp->hash = info->hash;
+		else if (hashp->HASH_VERSION == HASHVERSION)
+			hashp->hash = __default_hash;
+		else
+			hashp->hash = __compat_hash;
 		if (hashp->hash(CHARKEY, sizeof(CHARKEY)) != hashp->H_CHARKEY)
 			RETURN_ERROR(EFTYPE, error1);
                 /* Check bucket size isn't too big for target int. */
@@ -532,7 +539,14 @@ flush_meta(hashp)
 	if (!hashp->save_file)
 		return (0);
 	hashp->MAGIC = HASHMAGIC;
-	hashp->HASH_VERSION = HASHVERSION;
+	/*
+	 * A table hashed with hash4 keeps the version that selects it, or
+	 * the next open would pick the new default hash and reject it.
+	 */
+	if (hashp->hash == __compat_hash)
+		hashp->HASH_VERSION = HASH4VERSION;
+	else
+		hashp->HASH_VERSION = HASHVERSION;
 	hashp->H_CHARKEY = hashp->hash(CHARKEY, sizeof(CHARKEY));
 
 	fp = hashp->fp;
@@ -47,9 +47,13 @@ static __uint32_t hash2(const void *, size_t);
 static __uint32_t hash3(const void *, size_t);
 #endif
 static __uint32_t hash4(const void *, size_t);
+static __uint32_t hash5(const void *, size_t);
 
 /* Global default hash function */
-__uint32_t (*__default_hash)(const void *, size_t) = hash4;
+__uint32_t (*__default_hash)(const void *, size_t) = hash5;
+
+/* Default hash function of databases older than HASHVERSION 3 */
+__uint32_t (*__compat_hash)(const void *, size_t) = hash4;
 
 /*
  * HASH FUNCTIONS
@@ -214,3 +218,58 @@ hash4(keyarg, len)
 	}
 	return (h);
 }
+
+/*
+ * MurmurHash3_x86_32 by Austin Appleby, placed in the public domain,
+ * with a zero seed.  It consumes the key a 32 bit word at a time and
+ * ends with a full avalanche, so the low bits used to pick a bucket
+ * depend on all bytes of the key.  Words are read in little endian
+ * order to give the same value on all hosts, as required for files.
+ */
+#define ROTL32(x, r)	(((x) << (r)) | ((x) >> (32 - (r))))
+#define	LOAD32LE(p)	((__uint32_t)(p)[0] | (__uint32_t)(p)[1] << 8 | \
+			 (__uint32_t)(p)[2] << 16 | (__uint32_t)(p)[3] << 24)
+#define MURMUR_C1	0xcc9e2d51
+#define MURMUR_C2	0x1b873593
+
+static __uint32_t
+hash5(keyarg, len)
+	const void *keyarg;
+	size_t len;
+{
+	const u_char *key;
+	size_t loop;
+	__uint32_t h, k;
+
+	h = 0;
+	key = keyarg;
+	for (loop = len >> 2; loop; loop--, key += 4) {
+		k = LOAD32LE(key) * MURMUR_C1;
+		k = ROTL32(k, 15) * MURMUR_C2;
+		h ^= k;
+		h = ROTL32(h, 13) * 5 + 0xe6546b64;
+	}
+
+	k = 0;
+	switch (len & 3) {
+	case 3:
+		k ^= (__uint32_t)key[2] << 16;
+		/* FALLTHROUGH */
+	case 2:
+		k ^= (__uint32_t)key[1] << 8;
+		/* FALLTHROUGH */
+	case 1:
+		k ^= key[0];
+		k *= MURMUR_C1;
+		k = ROTL32(k, 15) * MURMUR_C2;
+		h ^= k;
+	}
+
+	h ^= (__uint32_t)len;
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+	return (h);
+}
@@ -0,0 +1,244 @@
+/*
+ * This file is in the public domain.
+ */
+/*
+FUNCTION
+<<qsort_key>>---sort an array by a numeric key
+
+INDEX
+	qsort_key
+
+SYNOPSIS
+	#include <stdlib.h>
+	int qsort_key(void *<[base]>, size_t <[nmemb]>, size_t <[size]>,
+		      size_t <[offset]>, int <[type]>);
+
+DESCRIPTION
+<<qsort_key>> sorts an array (beginning at <[base]>) of <[nmemb]>
+objects of <[size]> bytes in ascending order of a numeric key stored
+in each object at byte offset <[offset]>.  The key need not be
+aligned.  <[type]> describes the key and is one of
+
+o+
+o QSORT_KEY_U32
+<<uint32_t>>
+o QSORT_KEY_S32
+<<int32_t>>
+o QSORT_KEY_U64
+<<uint64_t>>
+o QSORT_KEY_S64
+<<int64_t>>
+o QSORT_KEY_F32
+<<float>>
+o QSORT_KEY_F64
+<<double>>
+o-
+
+Instead of calling a comparison function, <<qsort_key>> performs a
+least significant digit radix sort, one pass per byte of the key,
+skipping the bytes in which all keys agree.  It needs a scratch buffer
+of <[nmemb]> * <[size]> bytes.  Small arrays, arrays for which the
+buffer cannot be allocated and floating point keys on targets without
+IEEE 754 <<float>> or <<double>> are sorted with <<qsort>> semantics
+instead, so the order of elements with equal keys is unspecified.
+
+Floating point keys are ordered as by their numeric value, with
+<<-0.0>> before <<+0.0>>.  NaNs with the sign bit set sort before
+all other values, other NaNs after them.
+
+RETURNS
+<<qsort_key>> returns <<0>>.  If <[type]> is not one of the values
+above or the key does not fit into an object, it returns <<-1>> and
+sets <<errno>> to <<EINVAL>>.
+
+PORTABILITY
+<<qsort_key>> is a newlib extension.
+
+Supporting OS subroutines required: <<sbrk>>.
+*/
+
+#include <_ansi.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+#include <errno.h>
+#include "sortkey.h"
+
+extern void __bsd_qsort_r (void *, size_t, size_t, void *,
+			   int (*)(void *, const void *, const void *));
+
+/* Below this many elements the histogram passes cost more than they
+   save.  */
+#define RADIX_MIN 64
+
+struct key_desc
+{
+  size_t offset;
+  int type;
+};
+
+static int
+key_cmp (void *thunk,
+	const void *a,
+	const void *b)
+{
+  const struct key_desc *kd = thunk;
+  uint64_t ka, kb;
+
+#ifndef IEEE_FLOAT
+  if (kd->type == QSORT_KEY_F32)
+    {
+      float fa, fb;
+
+      memcpy (&fa, (const char *) a + kd->offset, sizeof fa);
+      memcpy (&fb, (const char *) b + kd->offset, sizeof fb);
+      return (fa > fb) - (fa < fb);
+    }
+#endif
+#ifndef IEEE_DOUBLE
+  if (kd->type == QSORT_KEY_F64)
+    {
+      double da, db;
+
+      memcpy (&da, (const char *) a + kd->offset, sizeof da);
+      memcpy (&db, (const char *) b + kd->offset, sizeof db);
+      return (da > db) - (da < db);
+    }
+#endif
+  ka = __get_sortkey (a, kd->offset, kd->type);
+  kb = __get_sortkey (b, kd->offset, kd->type);
+  return (ka > kb) - (ka < kb);
+}
+
+/* Copy one element; the common record sizes become plain moves.  */
+static inline void
+copy_elem (char *dst,
+	const char *src,
+	size_t size)
+{
+  switch (size)
+    {
+    case 4:
+      memcpy (dst, src, 4);
+      break;
+    case 8:
+      memcpy (dst, src, 8);
+      break;
+    case 16:
+      memcpy (dst, src, 16);
+      break;
+    default:
+      memcpy (dst, src, size);
+      break;
+    }
+}
+
+int
+qsort_key (void *base,
+	size_t nmemb,
+	size_t size,
+	size_t offset,
+	int type)
+{
+  struct key_desc kd;
+  size_t (*count)[256];
+  size_t keysize, i, n;
+  char *src, *dst, *tmp;
+  unsigned int pass, npasses;
+
+  switch (type)
+    {
+    case QSORT_KEY_U32:
+    case QSORT_KEY_S32:
+    case QSORT_KEY_F32:
+      keysize = 4;
+      break;
+    case QSORT_KEY_U64:
+    case QSORT_KEY_S64:
+    case QSORT_KEY_F64:
+      keysize = 8;
+      break;
+    default:
+      errno = EINVAL;
+      return -1;
+    }
+  if (size < keysize || offset > size - keysize)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  if (nmemb < 2)
+    return 0;
+
+  kd.offset = offset;
+  kd.type = type;
+  npasses = keysize;
+  count = NULL;
+  tmp = NULL;
+#ifndef IEEE_FLOAT
+  if (type == QSORT_KEY_F32)
+    goto fallback;
+#endif
+#ifndef IEEE_DOUBLE
+  if (type == QSORT_KEY_F64)
+    goto fallback;
+#endif
+  if (nmemb < RADIX_MIN || nmemb > SIZE_MAX / size)
+    goto fallback;
+  count = calloc (npasses, sizeof (*count));
+  tmp = malloc (nmemb * size);
+  if (count == NULL || tmp == NULL)
+    goto fallback;
+
+  /* Histograms of all key bytes in one sweep.  */
+  src = base;
+  for (i = 0; i < nmemb; i++, src += size)
+    {
+      uint64_t k = __get_sortkey (src, offset, type);
+
+      for (pass = 0; pass < npasses; pass++)
+	count[pass][(k >> (pass * 8)) & 0xff]++;
+    }
+
+  src = base;
+  dst = tmp;
+  for (pass = 0; pass < npasses; pass++)
+    {
+      size_t *c = count[pass];
+      size_t sum = 0;
+      char *p;
+
+      /* All keys share this byte; the pass would not move anything.  */
+      n = __get_sortkey (src, offset, type) >> (pass * 8) & 0xff;
+      if (c[n] == nmemb)
+	continue;
+      for (i = 0; i < 256; i++)
+	{
+	  n = c[i];
+	  c[i] = sum;
+	  sum += n;
+	}
+      p = src;
+      for (i = 0; i < nmemb; i++, p += size)
+	{
+	  uint64_t k = __get_sortkey (p, offset, type);
+
+	  copy_elem (dst + c[(k >> (pass * 8)) & 0xff]++ * size, p, size);
+	}
+      p = src;
+      src = dst;
+      dst = p;
+    }
+  if (src != base)
+    memcpy (base, src, nmemb * size);
+  free (tmp);
+  free (count);
+  return 0;
+
+fallback:
+  free (tmp);
+  free (count);
+  __bsd_qsort_r (base, nmemb, size, &kd, key_cmp);
+  return 0;
+}
@@ -0,0 +1,59 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Key access shared by qsort_key and bsearch_index_key.  */
+
+#ifndef _SORTKEY_H_
+#define _SORTKEY_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+
+#if FLT_MANT_DIG == 24 && FLT_MAX_EXP == 128
+#define IEEE_FLOAT 1
+#endif
+#if DBL_MANT_DIG == 53 && DBL_MAX_EXP == 1024
+#define IEEE_DOUBLE 1
+#endif
+
+/* Load the key of ELEM and map it to an unsigned integer with the same
+   order.  Signed keys get their sign bit flipped.  IEEE floating point
+   keys get all bits flipped if negative and only the sign bit flipped
+   otherwise.  */
+static inline uint64_t
+__get_sortkey (const char *elem,
+	size_t offset,
+	int type)
+{
+  uint32_t k32;
+  uint64_t k64;
+
+  switch (type)
+    {
+    case QSORT_KEY_U32:
+      memcpy (&k32, elem + offset, sizeof k32);
+      return k32;
+    case QSORT_KEY_S32:
+      memcpy (&k32, elem + offset, sizeof k32);
+      return k32 ^ UINT32_C (0x80000000);
+    case QSORT_KEY_F32:
+      memcpy (&k32, elem + offset, sizeof k32);
+      return (uint32_t) ((k32 & UINT32_C (0x80000000))
+			 ? ~k32 : k32 | UINT32_C (0x80000000));
+    case QSORT_KEY_U64:
+      memcpy (&k64, elem + offset, sizeof k64);
+      return k64;
+    case QSORT_KEY_S64:
+      memcpy (&k64, elem + offset, sizeof k64);
+      return k64 ^ (UINT64_C (1) << 63);
+    default: /* QSORT_KEY_F64 */
+      memcpy (&k64, elem + offset, sizeof k64);
+      return (k64 & (UINT64_C (1) << 63))
+	     ? ~k64 : k64 | (UINT64_C (1) << 63);
+    }
+}
+
+#endif /* _SORTKEY_H_ */
@@ -51,7 +51,8 @@ Use <<fflush>> to deliver any such pending output (for the file
 or stream identified by <[fp]>) to the host system.
 
 If <[fp]> is <<NULL>>, <<fflush>> delivers pending output from all
-open files.
+open files.  Only streams which have been written to since they were
+last flushed this way are visited; input streams are left alone.
 
 Additionally, if <[fp]> is a seekable input stream visiting a file
 descriptor, set the position of the file descriptor to match next
@@ -87,6 +88,7 @@ No supporting OS subroutines are required.
 #include <_ansi.h>
 #include <stdio.h>
 #include <errno.h>
+#include <sys/_sdt.h>
 #include "local.h"
 
 #ifdef __IMPL_UNLOCKED__
@@ -217,16 +219,21 @@ __sflush_r (struct _reent *ptr,
    * write function.
    */
   fp->_p = p;
-  fp->_w = flags & (__SLBF | __SNBF) ? 0 : fp->_bf._size;
+  if (_STDIO_ARMED (fp))
+    fp->_w = flags & (__SLBF | __SNBF) ? 0 : fp->_bf._size;
+
+  _LIBC_PROBE (stdio_flush, 2, fp, n);
 
   while (n > 0)
     {
       t = fp->_write (ptr, fp->_cookie, (char *) p, n);
+      _STDIO_STAT_ADD (fp, _writes, 1);
       if (t <= 0)
 	{
           fp->_flags |= __SERR;
           return EOF;
 	}
+      _STDIO_STAT_ADD (fp, _bytes_written, t);
       p += t;
       n -= t;
     }
@@ -245,6 +252,35 @@ __sflushw_r (struct _reent *ptr,
 }
 #endif
 
+/* Called by fflush(NULL) and _cleanup_r for every open stream.  Only
+   streams marked __SDIRTY can hold output, so the flag is tested
+   before taking the stream lock.  A successfully flushed stream is
+   disarmed (see _STDIO_ARMED) and drops out of the set until it is
+   written to again.  */
+int
+__sflush_dirty_r (struct _reent *ptr,
+       register FILE *fp)
+{
+  int ret = 0;
+
+  if ((fp->_flags2 & __SDIRTY) == 0)
+    return 0;
+
+  _newlib_flockfile_start (fp);
+  if (fp->_flags2 & __SDIRTY)
+    {
+      ret = __sflush_r (ptr, fp);
+      if (ret == 0)
+	{
+	  fp->_flags2 &= ~__SDIRTY;
+	  fp->_w = 0;
+	  fp->_lbfsize = 0;
+	}
+    }
+  _newlib_flockfile_end (fp);
+  return ret;
+}
+
 #endif /* __IMPL_UNLOCKED__ */
 
 int
@@ -286,7 +322,7 @@ int
 fflush (register FILE * fp)
 {
   if (fp == NULL)
-    return _fwalk_reent (_GLOBAL_REENT, _fflush_r);
+    return _fwalk_reent (_GLOBAL_REENT, __sflush_dirty_r);
 
   return _fflush_r (_REENT, fp);
 }
@@ -58,6 +58,9 @@ std (FILE *ptr,
   ptr->_bf._size = 0;
   ptr->_lbfsize = 0;
   memset (&ptr->_mbstate, 0, sizeof (_mbstate_t));
+#ifdef _WANT_STDIO_STATS
+  memset (&ptr->_stats, 0, sizeof (ptr->_stats));
+#endif
   ptr->_cookie = ptr;
   ptr->_read = __sread;
 #ifndef __LARGE64_FILES
@@ -183,6 +186,9 @@ found:
   fp->_bf._size = 0;
   fp->_lbfsize = 0;		/* not line buffered */
   memset (&fp->_mbstate, 0, sizeof (_mbstate_t));
+#ifdef _WANT_STDIO_STATS
+  memset (&fp->_stats, 0, sizeof (fp->_stats));
+#endif
   /* fp->_cookie = <any>; */	/* caller sets cookie, _read/_write etc */
   fp->_ub._base = NULL;		/* no ungetc buffer */
   fp->_ub._size = 0;
@@ -207,13 +213,15 @@ _cleanup_r (struct _reent *ptr)
 #ifdef _STDIO_BSD_SEMANTICS
   /* BSD and Glibc systems only flush streams which have been written to
      at exit time.  Calling flush rather than close for speed, as on
-     the aforementioned systems. */
-  cleanup_func = __sflushw_r;
+     the aforementioned systems.  Only streams with pending output are
+     locked and flushed. */
+  cleanup_func = __sflush_dirty_r;
 #else
   /* Otherwise close files and flush read streams, too.
-     Note we call flush directly if "--enable-lite-exit" is in effect.  */
+     Note we only flush streams with pending output if
+     "--enable-lite-exit" is in effect.  */
 #ifdef _LITE_EXIT
-  cleanup_func = _fflush_r;
+  cleanup_func = __sflush_dirty_r;
 #else
   cleanup_func = _fclose_r;
 #endif
@@ -83,7 +83,7 @@ _fpurge_r (struct _reent *ptr,
       if (HASUB (fp))
 	FREEUB (ptr, fp);
     }
-  else
+  else if (_STDIO_ARMED (fp))
     fp->_w = t & (__SLBF | __SNBF) ? 0 : fp->_bf._size;
   _newlib_flockfile_end (fp);
   return 0;
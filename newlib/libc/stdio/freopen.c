@@ -191,6 +191,7 @@ _freopen_r (struct _reent *ptr,
   fp->_bf._base = NULL;
   fp->_bf._size = 0;
   fp->_lbfsize = 0;
+  fp->_flags2 &= ~__SDIRTY;
   if (HASUB (fp))
     FREEUB (ptr, fp);
   fp->_ub._size = 0;
@@ -115,6 +115,8 @@ _fseeko_r (struct _reent *ptr,
 
   _newlib_flockfile_start (fp);
 
+  _STDIO_STAT_ADD (fp, _seeks, 1);
+
   /* If we've been doing some writing, and we're in append mode
      then we don't really know where the filepos is.  */
 
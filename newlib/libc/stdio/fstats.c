@@ -0,0 +1,125 @@
+/*
+ * This file is in the public domain.
+ */
+/*
+FUNCTION
+<<__fstats>>, <<__fstats_total>>---get I/O statistics of FILE streams
+
+INDEX
+	__fstats
+INDEX
+	__fstats_total
+
+SYNOPSIS
+	#include <stdio.h>
+	#include <stdio_ext.h>
+	int __fstats(FILE *<[fp]>, struct __sfstats *<[st]>);
+	int __fstats_total(struct __sfstats *<[st]>);
+
+DESCRIPTION
+If newlib has been configured with <<--enable-newlib-stdio-stats>>,
+every FILE stream keeps counters of the I/O it performed.  <<__fstats>>
+stores a snapshot of the counters of <[fp]> into <[st]>.  The members of
+<<struct __sfstats>> are:
+
+o+
+o _bytes_read
+Number of bytes delivered by the read function of the stream.
+o _bytes_written
+Number of bytes accepted by the write function of the stream.
+o _reads
+Number of calls of the read function, made when the buffer is refilled.
+o _writes
+Number of calls of the write function, made when the buffer is flushed
+or data is written bypassing the buffer.
+o _seeks
+Number of <<fseek>>, <<fseeko>> and <<rewind>> requests.
+o _buf_resizes
+Number of times a buffer was allocated or reallocated for the stream.
+o _locks
+Number of times a stdio function acquired the stream lock.
+o-
+
+<<__fstats_total>> stores into <[st]> the sum of the counters of all
+streams opened on a file descriptor, as visited by <<fflush(NULL)>>.
+The counters of a stream are discarded when the stream is closed.
+
+RETURNS
+Both functions return <<0>> on success.  If newlib has been configured
+without statistics support they return <<-1>> and set <<errno>> to
+<<ENOSYS>>.
+
+PORTABILITY
+These functions are newlib extensions.
+
+No supporting OS subroutines are required.
+*/
+
+#include <_ansi.h>
+#include <stdio.h>
+#include <stdio_ext.h>
+#include <string.h>
+#include <errno.h>
+#include "local.h"
+
+#ifdef _WANT_STDIO_STATS
+
+static struct __sfstats *fstats_sum;
+
+static int
+fstats_add (FILE *fp)
+{
+  fstats_sum->_bytes_read += fp->_stats._bytes_read;
+  fstats_sum->_bytes_written += fp->_stats._bytes_written;
+  fstats_sum->_reads += fp->_stats._reads;
+  fstats_sum->_writes += fp->_stats._writes;
+  fstats_sum->_seeks += fp->_stats._seeks;
+  fstats_sum->_buf_resizes += fp->_stats._buf_resizes;
+  fstats_sum->_locks += fp->_stats._locks;
+  return 0;
+}
+
+int
+__fstats (FILE *fp,
+       struct __sfstats *st)
+{
+  _newlib_flockfile_start (fp);
+  *st = fp->_stats;
+  _newlib_flockfile_end (fp);
+  return 0;
+}
+
+int
+__fstats_total (struct __sfstats *st)
+{
+  memset (st, 0, sizeof (*st));
+
+  /* The streams are not locked, so the sum is only approximate while
+     other threads perform I/O.  The stream list lock serializes the
+     users of fstats_sum.  */
+  _newlib_sfp_lock_start ();
+  fstats_sum = st;
+  _fwalk (_GLOBAL_REENT, fstats_add);
+  fstats_sum = NULL;
+  _newlib_sfp_lock_end ();
+  return 0;
+}
+
+#else /* !_WANT_STDIO_STATS */
+
+int
+__fstats (FILE *fp,
+       struct __sfstats *st)
+{
+  errno = ENOSYS;
+  return -1;
+}
+
+int
+__fstats_total (struct __sfstats *st)
+{
+  errno = ENOSYS;
+  return -1;
+}
+
+#endif /* !_WANT_STDIO_STATS */
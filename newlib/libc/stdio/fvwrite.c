@@ -97,8 +97,10 @@ __sfvwrite_r (struct _reent *ptr,
 	  GETIOV (;);
 	  w = fp->_write (ptr, fp->_cookie, p,
 			  MIN (len, INT_MAX - INT_MAX % BUFSIZ));
+	  _STDIO_STAT_ADD (fp, _writes, 1);
 	  if (w <= 0)
 	    goto err;
+	  _STDIO_STAT_ADD (fp, _bytes_written, w);
 	  p += w;
 	  len -= w;
 	}
@@ -169,6 +171,7 @@ __sfvwrite_r (struct _reent *ptr,
 		  fp->_bf._base = str;
 		  fp->_p = str + curpos;
 		  fp->_bf._size = newsize;
+		  _STDIO_STAT_ADD (fp, _buf_resizes, 1);
 		  w = len;
 		  fp->_w = newsize - curpos;
 		}
@@ -194,8 +197,10 @@ __sfvwrite_r (struct _reent *ptr,
 	      /* write directly */
 	      w = ((int)MIN (len, INT_MAX)) / fp->_bf._size * fp->_bf._size;
 	      w = fp->_write (ptr, fp->_cookie, p, w);
+	      _STDIO_STAT_ADD (fp, _writes, 1);
 	      if (w <= 0)
 		goto err;
+	      _STDIO_STAT_ADD (fp, _bytes_written, w);
 	    }
 	  p += w;
 	  len -= w;
@@ -235,8 +240,10 @@ __sfvwrite_r (struct _reent *ptr,
 	  else if (s >= (w = fp->_bf._size))
 	    {
 	      w = fp->_write (ptr, fp->_cookie, p, w);
+	      _STDIO_STAT_ADD (fp, _writes, 1);
 	      if (w <= 0)
 		goto err;
+	      _STDIO_STAT_ADD (fp, _bytes_written, w);
 	    }
 	  else
 	    {
@@ -0,0 +1,145 @@
+/*
+ * This file is in the public domain.
+ */
+/*
+FUNCTION
+<<fwritev>>---write several buffers to a stream
+
+INDEX
+	fwritev
+INDEX
+	_fwritev_r
+
+SYNOPSIS
+	#include <stdio.h>
+	#include <sys/uio.h>
+	size_t fwritev(FILE *restrict <[fp]>, const struct iovec *<[iov]>,
+		       int <[iovcnt]>);
+
+	#include <stdio.h>
+	#include <sys/uio.h>
+	size_t _fwritev_r(struct _reent *<[ptr]>, FILE *restrict <[fp]>,
+			  const struct iovec *<[iov]>, int <[iovcnt]>);
+
+DESCRIPTION
+<<fwritev>> writes the <[iovcnt]> buffers described by the array
+<[iov]> to the stream <[fp]>, in order, as if by one <<fwrite>> call
+per buffer.  The stream is locked only once for the whole operation,
+so the output of other threads is never interleaved between the
+buffers.  Buffers which do not fit into the stream buffer are passed
+to the underlying write function directly instead of being copied.
+
+<<_fwritev_r>> is a reentrant version of <<fwritev>> that takes an
+additional reentrant structure argument: <[ptr]>.
+
+RETURNS
+<<fwritev>> returns the number of bytes written.  It is smaller than
+the total length of the buffers only if an error occurred, in which
+case the error indicator of the stream is set.  If <[iovcnt]> is
+negative or the total length overflows a <<size_t>>, <<fwritev>>
+returns <<0>> and sets <<errno>> to <<EINVAL>>.
+
+PORTABILITY
+<<fwritev>> is a newlib extension.
+
+Supporting OS subroutines required: <<close>>, <<fstat>>, <<isatty>>,
+<<lseek>>, <<read>>, <<sbrk>>, <<write>>.
+*/
+
+#include <_ansi.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <errno.h>
+#include <sys/uio.h>
+#include "local.h"
+#include "fvwrite.h"
+
+/* Number of fragments handed to __sfvwrite_r at once.  */
+#define IOV_BATCH 8
+
+size_t
+_fwritev_r (struct _reent * ptr,
+       FILE * __restrict fp,
+       const struct iovec * iov,
+       int iovcnt)
+{
+  size_t total = 0;
+  size_t done = 0;
+  int i;
+#ifdef _FVWRITE_IN_STREAMIO
+  struct __suio uio;
+  struct __siov siov[IOV_BATCH];
+  int n, j;
+#else
+  size_t j;
+#endif
+
+  if (iovcnt < 0)
+    {
+      ptr->_errno = EINVAL;
+      return 0;
+    }
+  for (i = 0; i < iovcnt; i++)
+    {
+      if (iov[i].iov_len > SIZE_MAX - total)
+	{
+	  ptr->_errno = EINVAL;
+	  return 0;
+	}
+      total += iov[i].iov_len;
+    }
+
+  CHECK_INIT(ptr, fp);
+
+  _newlib_flockfile_start (fp);
+  ORIENT (fp, -1);
+#ifdef _FVWRITE_IN_STREAMIO
+  for (i = 0; i < iovcnt; i += n)
+    {
+      n = iovcnt - i < IOV_BATCH ? iovcnt - i : IOV_BATCH;
+      uio.uio_iov = siov;
+      uio.uio_iovcnt = n;
+      uio.uio_resid = 0;
+      for (j = 0; j < n; j++)
+	{
+	  siov[j].iov_base = iov[i + j].iov_base;
+	  siov[j].iov_len = iov[i + j].iov_len;
+	  uio.uio_resid += siov[j].iov_len;
+	}
+      total = uio.uio_resid;
+      if (__sfvwrite_r (ptr, fp, &uio) != 0)
+	{
+	  done += total - uio.uio_resid;
+	  break;
+	}
+      done += total;
+    }
+#else
+  /* Make sure we can write.  */
+  if (cantwrite (ptr, fp))
+    goto ret;
+
+  for (i = 0; i < iovcnt; i++)
+    {
+      const char *p = iov[i].iov_base;
+
+      for (j = 0; j < iov[i].iov_len; j++, done++)
+	if (__sputc_r (ptr, p[j], fp) == EOF)
+	  goto ret;
+    }
+
+ret:
+#endif
+  _newlib_flockfile_end (fp);
+  return done;
+}
+
+#ifndef _REENT_ONLY
+size_t
+fwritev (FILE * __restrict fp,
+       const struct iovec * iov,
+       int iovcnt)
+{
+  return _fwritev_r (_REENT, fp, iov, iovcnt);
+}
+#endif
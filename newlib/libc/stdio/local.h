@@ -42,6 +42,14 @@
 #define _STDIO_CLOSE_PER_REENT_STD_STREAMS
 #endif
 
+/* Update one of the per-stream statistics counters in fp->_stats.  The
+   stream should be locked by the caller.  */
+#ifdef _WANT_STDIO_STATS
+#define _STDIO_STAT_ADD(fp, counter, n) ((fp)->_stats.counter += (n))
+#else
+#define _STDIO_STAT_ADD(fp, counter, n) ((void) 0)
+#endif
+
 /* The following macros are supposed to replace calls to _flockfile/_funlockfile
    and __sfp_lock_acquire/__sfp_lock_release.  In case of multi-threaded
    environments using pthreads, it's not sufficient to lock the stdio functions
@@ -78,7 +86,10 @@
 	  int __oldfpcancel; \
 	  pthread_setcancelstate (PTHREAD_CANCEL_DISABLE, &__oldfpcancel); \
 	  if (!(_fp->_flags2 & __SNLK)) \
-	    _flockfile (_fp)
+	    { \
+	      _flockfile (_fp); \
+	      _STDIO_STAT_ADD (_fp, _locks, 1); \
+	    }
 
 /* Exit from a stream oriented critical section prematurely: */
 # define _newlib_flockfile_exit(_fp) \
@@ -116,7 +127,10 @@
 # define _newlib_flockfile_start(_fp) \
 	{ \
 		if (!(_fp->_flags2 & __SNLK)) \
-		  _flockfile (_fp)
+		  { \
+		    _flockfile (_fp); \
+		    _STDIO_STAT_ADD (_fp, _locks, 1); \
+		  }
 
 # define _newlib_flockfile_exit(_fp) \
 		if (!(_fp->_flags2 & __SNLK)) \
@@ -167,6 +181,7 @@ extern int    __sflush_r (struct _reent *,FILE *);
 #ifdef _STDIO_BSD_SEMANTICS
 extern int    __sflushw_r (struct _reent *,FILE *);
 #endif
+extern int    __sflush_dirty_r (struct _reent *,FILE *);
 extern int    __srefill_r (struct _reent *,FILE *);
 extern _READ_WRITE_RETURN_TYPE __sread (struct _reent *, void *, char *,
 					       _READ_WRITE_BUFSIZE_TYPE);
@@ -236,8 +251,19 @@ extern _READ_WRITE_RETURN_TYPE __swrite64 (struct _reent *, void *,
    cannot be written now.  */
 
 #define	cantwrite(ptr, fp)                                     \
-  ((((fp)->_flags & __SWR) == 0 || (fp)->_bf._base == NULL) && \
-   __swsetup_r(ptr, fp))
+  ((((fp)->_flags & __SWR) == 0 || (fp)->_bf._base == NULL || \
+    !_STDIO_ARMED (fp)) && __swsetup_r(ptr, fp))
+
+/* A buffered stream is armed for output (_w or _lbfsize set up for
+   the putc macro) only while __SDIRTY is set in _flags2.  __swsetup_r
+   sets the flag, __sflush_dirty_r flushes the stream on behalf of
+   fflush(NULL) and exit and then disarms it again, so that the next
+   write goes through cantwrite and marks the stream anew.  Global
+   flushes thus only have to lock the streams carrying the flag.
+   Unbuffered and string streams never hold pending output and are
+   not tracked.  */
+#define _STDIO_ARMED(fp) \
+  (((fp)->_flags2 & __SDIRTY) || ((fp)->_flags & (__SNBF | __SSTR)))
 
 /* Test whether the given stdio file has an active ungetc buffer;
    release such a buffer, without restoring ordinary unread data.  */
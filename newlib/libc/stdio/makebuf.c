@@ -65,6 +65,7 @@ __smakebuf_r (struct _reent *ptr,
       fp->_flags |= __SMBF;
       fp->_bf._base = fp->_p = (unsigned char *) p;
       fp->_bf._size = size;
+      _STDIO_STAT_ADD (fp, _buf_resizes, 1);
       if (couldbetty && _isatty_r (ptr, fp->_file))
 	fp->_flags = (fp->_flags & ~__SNBF) | __SLBF;
       fp->_flags |= flags;
@@ -222,6 +222,7 @@ __ssputs_r (struct _reent *ptr,
       fp->_bf._base = str;
       fp->_p = str + curpos;
       fp->_bf._size = newsize;
+      _STDIO_STAT_ADD (fp, _buf_resizes, 1);
       w = len;
       fp->_w = newsize - curpos;
     }
@@ -313,6 +314,7 @@ __ssprint_r (struct _reent *ptr,
 	  fp->_bf._base = str;
 	  fp->_p = str + curpos;
 	  fp->_bf._size = newsize;
+	  _STDIO_STAT_ADD (fp, _buf_resizes, 1);
 	  w = len;
 	  fp->_w = newsize - curpos;
 	}
@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <sys/_sdt.h>
 #include "local.h"
 
 static int
@@ -68,6 +69,7 @@ __srefill_r (struct _reent * ptr,
 	  if (_fflush_r (ptr, fp))
 	    return EOF;
 	  fp->_flags &= ~__SWR;
+	  fp->_flags2 &= ~__SDIRTY;
 	  fp->_w = 0;
 	  fp->_lbfsize = 0;
 	}
@@ -115,6 +117,8 @@ __srefill_r (struct _reent * ptr,
 
   fp->_p = fp->_bf._base;
   fp->_r = fp->_read (ptr, fp->_cookie, (char *) fp->_p, fp->_bf._size);
+  _LIBC_PROBE (stdio_refill, 2, fp, fp->_r);
+  _STDIO_STAT_ADD (fp, _reads, 1);
 #ifndef __CYGWIN__
   if (fp->_r <= 0)
 #else
@@ -132,5 +136,6 @@ __srefill_r (struct _reent * ptr,
 	}
       return EOF;
     }
+  _STDIO_STAT_ADD (fp, _bytes_read, fp->_r);
   return 0;
 }
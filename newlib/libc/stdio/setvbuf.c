@@ -117,6 +117,7 @@ setvbuf (register FILE * fp,
    * non buffer flags, and clear malloc flag.
    */
   _newlib_flockfile_start (fp);
+  _STDIO_STAT_ADD (fp, _buf_resizes, 1);
   _fflush_r (reent, fp);
   if (HASUB(fp))
     FREEUB(reent, fp);
@@ -210,6 +211,7 @@ nbf:
 	}
       else
         fp->_w = size;
+      fp->_flags2 |= __SDIRTY;
     }
   else
     {
@@ -149,6 +149,7 @@ _ungetc_r (struct _reent *rptr,
               return EOF;
             }
 	  fp->_flags &= ~__SWR;
+	  fp->_flags2 &= ~__SDIRTY;
 	  fp->_w = 0;
 	  fp->_lbfsize = 0;
 	}
@@ -89,5 +89,7 @@ __swsetup_r (struct _reent *ptr,
       fp->_flags |= __SERR;
       return EOF;
     }
+  if (!(fp->_flags & (__SNBF | __SSTR)))
+    fp->_flags2 |= __SDIRTY;
   return 0;
 }
@@ -114,6 +114,8 @@ _fseeko64_r (struct _reent *ptr,
 
   _newlib_flockfile_start (fp);
 
+  _STDIO_STAT_ADD (fp, _seeks, 1);
+
   curoff = fp->_offset;
 
   /* If we've been doing some writing, and we're in append mode
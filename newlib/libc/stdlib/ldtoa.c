@@ -2781,6 +2781,179 @@ _IO_ldtostr (x, string, ndigs, flags, fmt)
 
 #endif
 
+#if LDBL_MANT_DIG == 64 && (defined (__i386__) || defined (__x86_64__))
+#define LDTOA_FAST
+
+/* Exact conversion of x86 extended precision values of moderate
+   magnitude.  A normal value m * 2^e with a 64-bit m and
+   -128 <= e <= 64 has at most 39 integer and 128 fraction digits, so
+   its decimal expansion is computed exactly with 32-bit limb
+   arithmetic, nine digits per step, instead of with the e-type
+   arithmetic of etoasc.  Other values and modes use the general path.
+   Rounding is to nearest, ties to even.  Returns the number of digits
+   stored into buf, or -1 if the value is not handled.  */
+
+#define FAST_NDIG (39 + 135 + 2)
+
+static void
+put9 (char *buf,
+	__uint32_t v)
+{
+  int i;
+
+  for (i = 8; i >= 0; i--)
+    {
+      buf[i] = '0' + v % 10;
+      v /= 10;
+    }
+}
+
+static int
+ldtoa_fast (long double d,
+	int mode,
+	int ndigits,
+	int *decpt,
+	int *sign,
+	char *buf)
+{
+  unsigned short w[5];
+  __uint32_t n[8], chunk[5];
+  __uint32_t m0, m1, v;
+  int e, sh, q, r, i, nc, len, p, lead, cut, z, up;
+
+  memcpy (w, &d, sizeof (w));
+  *sign = w[4] >> 15;
+  e = w[4] & 0x7fff;
+  if (e == 0 && (w[0] | w[1] | w[2] | w[3]) == 0)
+    {
+      buf[0] = '0';
+      buf[1] = '\0';
+      *decpt = 1;
+      return 1;
+    }
+  /* Denormals, unnormals, infinities and NaNs.  */
+  if (e == 0 || e == 0x7fff || (w[3] & 0x8000) == 0)
+    return -1;
+  e -= 16383 + 63;
+  if (e < -128 || e > 64 || (mode != 2 && mode != 3)
+      || (mode == 3 && ndigits < 0))
+    return -1;
+  if (mode == 2 && ndigits < 1)
+    ndigits = 1;
+
+  /* n[4..7] is the integer part, n[0..3] the fraction.  */
+  m0 = w[0] | (__uint32_t) w[1] << 16;
+  m1 = w[2] | (__uint32_t) w[3] << 16;
+  memset (n, 0, sizeof (n));
+  sh = 128 + e;
+  q = sh / 32;
+  r = sh % 32;
+  n[q] = m0 << r;
+  n[q + 1] = m1 << r;
+  if (r != 0)
+    {
+      n[q + 1] |= m0 >> (32 - r);
+      n[q + 2] = m1 >> (32 - r);
+    }
+
+  for (nc = 0; (n[4] | n[5] | n[6] | n[7]) != 0; nc++)
+    {
+      __uint64_t t = 0;
+
+      for (i = 7; i >= 4; i--)
+	{
+	  t = t << 32 | n[i];
+	  n[i] = (__uint32_t) (t / 1000000000);
+	  t %= 1000000000;
+	}
+      chunk[nc] = (__uint32_t) t;
+    }
+  len = 0;
+  if (nc > 0)
+    {
+      char tmp[9];
+
+      put9 (tmp, chunk[--nc]);
+      for (i = 0; tmp[i] == '0'; i++)
+	;
+      memcpy (buf, tmp + i, 9 - i);
+      len = 9 - i;
+      while (nc > 0)
+	{
+	  put9 (buf + len, chunk[--nc]);
+	  len += 9;
+	}
+    }
+  p = len;
+  lead = len > 0 ? 0 : -1;
+
+  /* Fraction digits, up to the rounding digit.  */
+  cut = mode == 3 ? p + ndigits : lead + ndigits;
+  while ((n[0] | n[1] | n[2] | n[3]) != 0 && (lead < 0 || len <= cut))
+    {
+      __uint64_t t = 0;
+
+      for (i = 0; i < 4; i++)
+	{
+	  t += (__uint64_t) n[i] * 1000000000;
+	  n[i] = (__uint32_t) t;
+	  t >>= 32;
+	}
+      put9 (buf + len, (__uint32_t) t);
+      if (lead < 0 && t != 0)
+	{
+	  for (lead = len; buf[lead] == '0'; lead++)
+	    ;
+	  if (mode == 2)
+	    cut = lead + ndigits;
+	}
+      len += 9;
+    }
+
+  if (cut < len)
+    {
+      v = (n[0] | n[1] | n[2] | n[3]) != 0;
+      for (i = cut + 1; i < len && !v; i++)
+	v = buf[i] != '0';
+      up = buf[cut] > '5'
+	   || (buf[cut] == '5' && (v || (cut > 0 && (buf[cut - 1] & 1))));
+      len = cut;
+      if (up)
+	{
+	  for (i = len - 1; i >= 0 && buf[i] == '9'; i--)
+	    buf[i] = '0';
+	  if (i >= 0)
+	    buf[i]++;
+	  else
+	    {
+	      memmove (buf + 1, buf, len);
+	      buf[0] = '1';
+	      len++;
+	      p++;
+	    }
+	}
+    }
+
+  for (z = 0; z < len && buf[z] == '0'; z++)
+    ;
+  if (z == len)
+    {
+      /* In f format the value was below the precision.  */
+      buf[0] = '\0';
+      *decpt = 0;
+      return 0;
+    }
+  memmove (buf, buf + z, len - z);
+  len -= z;
+  *decpt = p - z;
+  while (buf[len - 1] == '0')
+    len--;
+  buf[len] = '\0';
+  return len;
+}
+
+#endif /* LDTOA_FAST */
+
 /* This routine will not return more than NDEC+1 digits. */
 
 char *
@@ -2813,6 +2986,35 @@ _ldtoa_r (struct _reent *ptr, long double d, int mode, int ndigits,
       _REENT_MP_RESULT (ptr) = 0;
     }
 
+#ifdef LDTOA_FAST
+  {
+    char fbuf[FAST_NDIG + 1];
+
+    i = ldtoa_fast (d, mode, ndigits, decpt, sign, fbuf);
+    if (i >= 0)
+      {
+	/* The caller may pad the digits with zeros in place, so size the
+	   result as the slow path below does.  */
+	if (mode == 3)
+	  k = *decpt + orig_ndigits + 3;
+	else
+	  k = orig_ndigits + MAX_EXP_DIGITS + 4;
+	if (k < i + 1)
+	  k = i + 1;
+	j = sizeof (__ULong);
+	for (_REENT_MP_RESULT_K (ptr) = 0;
+	     sizeof (_Bigint) - sizeof (__ULong) + j <= k; j <<= 1)
+	  _REENT_MP_RESULT_K (ptr)++;
+	_REENT_MP_RESULT (ptr) = eBalloc (ptr, _REENT_MP_RESULT_K (ptr));
+	outstr = (char *) _REENT_MP_RESULT (ptr);
+	memcpy (outstr, fbuf, i + 1);
+	if (rve)
+	  *rve = outstr + i;
+	return outstr;
+      }
+  }
+#endif
+
 #if LDBL_MANT_DIG == 24
   e24toe (&du.pe, e, ldp);
 #elif LDBL_MANT_DIG == 53
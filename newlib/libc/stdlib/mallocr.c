@@ -302,6 +302,7 @@ extern "C" {
  */
 
 #include <reent.h>
+#include <sys/_sdt.h>
 
 #define POINTER_UINT unsigned _POINTER_INT
 #define SEPARATE_OBJECTS
@@ -2012,6 +2013,8 @@ static mchunkptr mmap_chunk(size) size_t size;
 
   if(p == (mchunkptr)-1) return 0;
 
+  _LIBC_PROBE (memory_mmap, 2, p, size);
+
   n_mmaps++;
   if (n_mmaps > max_n_mmaps) max_n_mmaps = n_mmaps;
   
@@ -2058,6 +2061,9 @@ STATIC void munmap_chunk(p) mchunkptr p;
   n_mmaps--;
   mmapped_mem -= (size + p->prev_size);
 
+  _LIBC_PROBE (memory_munmap, 2, (char *)p - p->prev_size,
+	       size + p->prev_size);
+
   ret = munmap((char *)p - p->prev_size, size + p->prev_size);
 
   /* munmap returns non-zero on failure */
@@ -2169,6 +2175,8 @@ static void malloc_extend_top(RARG nb) RDECL INTERNAL_SIZE_T nb;
       (brk < old_end && old_top != initial_top))
     return;
 
+  _LIBC_PROBE (memory_sbrk_more, 2, brk, sbrk_size);
+
   sbrked_mem += sbrk_size;
 
   if (brk == old_end /* can just add bytes to current top, unless
@@ -3362,6 +3370,7 @@ int malloc_trim(RARG pad) RDECL size_t pad;
       else
       {
         /* Success. Adjust top accordingly. */
+        _LIBC_PROBE (memory_sbrk_less, 2, new_brk, extra);
         set_head(top, (top_size - extra) | PREV_INUSE);
         sbrked_mem -= extra;
         check_chunk(top);
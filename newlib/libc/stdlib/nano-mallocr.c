@@ -36,6 +36,7 @@
 #include <string.h>
 #include <errno.h>
 #include <malloc.h>
+#include <sys/_sdt.h>
 
 #if DEBUG
 #include <assert.h>
@@ -223,6 +224,7 @@ static void* sbrk_aligned(RARG malloc_size_t s)
         if (p == (void *)-1)
             return p;
     }
+    _LIBC_PROBE (memory_sbrk_more, 2, align_p, s);
     return align_p;
 }
 
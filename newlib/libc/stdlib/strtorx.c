@@ -33,6 +33,7 @@ THIS SOFTWARE.
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <float.h>
 #include "mprec.h"
 #include "gdtoa.h"
 
@@ -95,6 +96,104 @@ ULtox(__UShort *L, __ULong *bits, Long exp, int k)
 		L[_0] |= 0x8000;
 	}
 
+#if LDBL_MANT_DIG == 64 && (defined (__i386__) || defined (__x86_64__)) \
+    && !defined (__iamcu__)
+/* Clinger's fast path for the x87 format: a decimal significand of at
+   most 19 digits and a power of ten up to 10^27 (5^27 < 2^64) are both
+   exact long doubles, so a single x87 multiplication or division
+   rounds the quotient correctly.  This holds only while the x87
+   computes with a 64-bit mantissa in the requested rounding mode.
+   Returns 0 if the input needs the general conversion.  */
+
+static const long double ltens[] = {
+	1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L,
+	1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L,
+	1e19L, 1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+	};
+
+/* The FPI_Round_* value of each x87 rounding control setting.  */
+static const int rc_map[] = {
+	FPI_Round_near, FPI_Round_down, FPI_Round_up, FPI_Round_zero
+	};
+
+ static int
+strtorx_fast(const char *s, char **sp, int rounding, long double *L,
+	     locale_t loc)
+{
+	const char *decimal_point = __get_numeric_locale(loc)->decimal_point;
+	int dec_len = strlen(decimal_point);
+	unsigned long long m = 0;
+	int nd = 0, nz = 0, e = 0, esign, ee, neg = 0;
+	unsigned short cw;
+	const char *q;
+	long double r;
+
+	__asm__ ("fnstcw %0" : "=m" (cw));
+	/* Precision control 3 is the 64-bit mantissa.  */
+	if (((cw >> 8) & 3) != 3 || rc_map[(cw >> 10) & 3] != rounding)
+		return 0;
+
+	if (*s == '-') {
+		neg = 1;
+		s++;
+		}
+	else if (*s == '+')
+		s++;
+	if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X'))
+		return 0;
+	for(; *s >= '0' && *s <= '9'; s++, nz++) {
+		if (m == 0 && *s == '0')
+			continue;
+		if (++nd > 19)
+			return 0;
+		m = m * 10 + (*s - '0');
+		}
+	if (strncmp(s, decimal_point, dec_len) == 0) {
+		q = s + dec_len;
+		for(; *q >= '0' && *q <= '9'; q++, nz++, e--) {
+			if (m == 0 && *q == '0')
+				continue;
+			if (++nd > 19)
+				return 0;
+			m = m * 10 + (*q - '0');
+			}
+		if (q > s + dec_len || nz > 0)
+			s = q;
+		}
+	if (nz == 0)
+		return 0;
+	if (*s == 'e' || *s == 'E') {
+		q = s + 1;
+		esign = 1;
+		if (*q == '-') {
+			esign = -1;
+			q++;
+			}
+		else if (*q == '+')
+			q++;
+		if (*q >= '0' && *q <= '9') {
+			for(ee = 0; *q >= '0' && *q <= '9'; q++)
+				if (ee < 10000)
+					ee = ee * 10 + (*q - '0');
+			e += esign * ee;
+			s = q;
+			}
+		}
+	if (m == 0)
+		r = 0;
+	else if (e >= 0 && e <= 27)
+		r = (long double)m * ltens[e];
+	else if (e < 0 && e >= -27)
+		r = (long double)m / ltens[-e];
+	else
+		return 0;
+	*L = neg ? -r : r;
+	if (sp)
+		*sp = (char *)s;
+	return 1;
+	}
+#endif
+
  int
 #ifdef KR_headers
 _strtorx_l(p, s, sp, rounding, L, loc) struct _reent *p; const char *s; char **sp; int rounding; void *L; locale_t loc;
@@ -109,6 +208,11 @@ _strtorx_l(struct _reent *p, const char *s, char **sp, int rounding, void *L,
 	Long exp;
 	int k;
 
+#if LDBL_MANT_DIG == 64 && (defined (__i386__) || defined (__x86_64__)) \
+    && !defined (__iamcu__)
+	if (strtorx_fast(s, sp, rounding, (long double *)L, loc))
+		return *(long double *)L == 0 ? STRTOG_Zero : STRTOG_Normal;
+#endif
 	fpi = &fpi0;
 	if (rounding != FPI_Round_near) {
 		fpi1 = fpi0;
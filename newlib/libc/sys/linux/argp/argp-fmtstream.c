@@ -112,6 +112,29 @@ __argp_fmtstream_free (argp_fmtstream_t fs)
 weak_alias (__argp_fmtstream_free, argp_fmtstream_free)
 #endif
 
+/* Grow FS's buffer so that it has room for AMOUNT more bytes, at least
+   doubling it to keep the number of reallocations small.  Pointers into the
+   old buffer must be recomputed by the caller.  True is returned iff we
+   succeed.  */
+static int
+fmtstream_grow (argp_fmtstream_t fs, size_t amount)
+{
+  size_t used = fs->p - fs->buf;
+  size_t new_size = 2 * (fs->end - fs->buf);
+  char *new_buf;
+
+  if (new_size < used + amount)
+    new_size = used + amount;
+  new_buf = realloc (fs->buf, new_size);
+  if (! new_buf)
+    return 0;
+
+  fs->buf = new_buf;
+  fs->p = new_buf + used;
+  fs->end = new_buf + new_size;
+  return 1;
+}
+
 /* Process FS's buffer so that line wrapping is done from POINT_OFFS to the
    end of its buffer.  This code is mostly from glibc stdio/linewrap.c.  */
 void
@@ -130,6 +153,12 @@ __argp_fmtstream_update (argp_fmtstream_t fs)
 	{
 	  /* We are starting a new line.  Print spaces to the left margin.  */
 	  const size_t pad = fs->lmargin;
+	  if (fs->p + pad >= fs->end)
+	    {
+	      size_t buf_offs = buf - fs->buf;
+	      fmtstream_grow (fs, pad + 1);
+	      buf = fs->buf + buf_offs;
+	    }
 	  if (fs->p + pad < fs->end)
 	    {
 	      /* We can fit in them in the buffer by moving the
@@ -141,7 +170,7 @@ __argp_fmtstream_update (argp_fmtstream_t fs)
 	    }
 	  else
 	    {
-	      /* No buffer space for spaces.  Must flush.  */
+	      /* Out of memory for spaces.  Must flush.  */
 	      size_t i;
 	      for (i = 0; i < pad; i++)
 		{
@@ -267,6 +296,19 @@ __argp_fmtstream_update (argp_fmtstream_t fs)
 	     at the end of the buffer, and NEXTLINE is in fact empty (and so
 	     we need not be careful to maintain its contents).  */
 
+	  if (fs->end - fs->p <= fs->wmargin + 1)
+	    {
+	      /* Make room for the blanks of the wrap margin, so that none of
+		 the text needs to be output before FS is flushed.  */
+	      size_t buf_offs = buf - fs->buf;
+	      size_t nl_offs = nl - fs->buf;
+	      size_t nextline_offs = nextline - fs->buf;
+	      fmtstream_grow (fs, fs->wmargin + 2);
+	      buf = fs->buf + buf_offs;
+	      nl = fs->buf + nl_offs;
+	      nextline = fs->buf + nextline_offs;
+	    }
+
 	  if (nextline == buf + len + 1
 	      ? fs->end - nl < fs->wmargin + 1
 	      : nextline - (nl + 1) < fs->wmargin)
@@ -282,7 +324,8 @@ __argp_fmtstream_update (argp_fmtstream_t fs)
 		  *nl++ = '\n';
 		}
 	      else
-		/* Output the first line so we can use the space.  */
+		/* Out of memory.  Output the first line so we can use the
+		   space.  */
 		{
 #ifdef USE_IN_LIBIO
 		  if (_IO_fwide (fs->stream, 0) > 0)
@@ -342,7 +385,10 @@ __argp_fmtstream_update (argp_fmtstream_t fs)
 }
 
 /* Ensure that FS has space for AMOUNT more bytes in its buffer, either by
-   growing the buffer, or by flushing it.  True is returned iff we succeed. */
+   growing the buffer, or by flushing it.  The buffer is only flushed if it
+   cannot grow, so normally all text written to FS is laid out in memory and
+   goes to the stream in one write when FS is freed.  True is returned iff we
+   succeed. */
 int
 __argp_fmtstream_ensure (struct argp_fmtstream *fs, size_t amount)
 {
@@ -350,7 +396,10 @@ __argp_fmtstream_ensure (struct argp_fmtstream *fs, size_t amount)
     {
       ssize_t wrote;
 
-      /* Flush FS's buffer.  */
+      if (fmtstream_grow (fs, amount))
+	return 1;
+
+      /* Out of memory.  Flush FS's buffer.  */
       __argp_fmtstream_update (fs);
 
 #ifdef USE_IN_LIBIO
@@ -180,24 +180,6 @@ argp_version_parser (int key, char *arg, struct argp_state *state)
 static const struct argp argp_version_argp =
   {argp_version_options, &argp_version_parser, NULL, NULL, NULL, NULL, "libc"};
 
-/* Returns the offset into the getopt long options array LONG_OPTIONS of a
-   long option with called NAME, or -1 if none is found.  Passing NULL as
-   NAME will return the number of options.  */
-static int
-find_long_option (struct option *long_options, const char *name)
-{
-  struct option *l = long_options;
-  while (l->name != NULL)
-    if (name != NULL && strcmp (l->name, name) == 0)
-      return l - long_options;
-    else
-      l++;
-  if (name == NULL)
-    return l - long_options;
-  else
-    return -1;
-}
-
 /* If we can, we regulate access to getopt, which is non-reentrant, with a
    mutex.  Since the case we're trying to guard against is two different
    threads interfering, and it's possible that someone might want to call
@@ -294,6 +276,14 @@ struct parser
   /* LONG_OPTS is the array of getop long option structures for the union of
      all the groups of options.  */
   struct option *long_opts;
+  /* LONG_HASH is an open addressing hash table of the names in LONG_OPTS,
+     with LONG_HASH_SIZE (a power of two) slots.  A slot holds the index of
+     an entry in LONG_OPTS plus one, or 0 if it is free.  */
+  unsigned *long_hash;
+  size_t long_hash_size;
+  /* SHORT_GROUPS maps each character in SHORT_OPTS to the group whose
+     option it is.  */
+  struct group **short_groups;
 
   /* States of the various parsing groups.  */
   struct group *groups;
@@ -315,6 +305,27 @@ struct parser
   void *storage;
 };
 
+/* Returns the slot in PARSER's hash table of long options for NAME, which
+   is either free or refers to the option called NAME.  */
+static unsigned *
+find_long_option (struct parser *parser, const char *name)
+{
+  size_t mask = parser->long_hash_size - 1;
+  size_t hash = 0;
+  const char *p;
+
+  for (p = name; *p != '\0'; p++)
+    hash = hash * 31 + (unsigned char) *p;
+
+  for (;; hash++)
+    {
+      unsigned *slot = &parser->long_hash[hash & mask];
+      if (*slot == 0
+	  || strcmp (parser->long_opts[*slot - 1].name, name) == 0)
+	return slot;
+    }
+}
+
 /* The next usable entries in the various parser tables being filled in by
    convert_options.  */
 struct parser_convert_state
@@ -341,6 +352,7 @@ convert_options (const struct argp *argp,
   if (real || argp->parser)
     {
       const struct argp_option *opt;
+      unsigned *slot;
 
       if (real)
 	for (opt = real; !__option_is_end (opt); opt++)
@@ -355,6 +367,12 @@ convert_options (const struct argp *argp,
 		if (__option_is_short (opt))
 		  /* OPT can be used as a short option.  */
 		  {
+		    /* As with a search of SHORT_OPTS, the first group using
+		       a character gets it.  */
+		    if (! cvt->parser->short_groups[(unsigned char) opt->key])
+		      cvt->parser->short_groups[(unsigned char) opt->key] =
+			group;
+
 		    *cvt->short_end++ = opt->key;
 		    if (real->arg)
 		      {
@@ -366,9 +384,10 @@ convert_options (const struct argp *argp,
 		  }
 
 		if (opt->name
-		    && find_long_option (cvt->parser->long_opts, opt->name) < 0)
+		    && *(slot = find_long_option (cvt->parser, opt->name)) == 0)
 		  /* OPT can be used as a long option.  */
 		  {
+		    *slot = cvt->long_end - cvt->parser->long_opts + 1;
 		    cvt->long_end->name = opt->name;
 		    cvt->long_end->has_arg =
 		      (real->arg
@@ -505,6 +524,7 @@ parser_init (struct parser *parser, const struct argp *argp,
   error_t err = 0;
   struct group *group;
   struct parser_sizes szs;
+  size_t hash_size;
 
   szs.short_len = (flags & ARGP_NO_ARGS) ? 0 : 1;
   szs.long_len = 0;
@@ -518,18 +538,28 @@ parser_init (struct parser *parser, const struct argp *argp,
 #define GLEN (szs.num_groups + 1) * sizeof (struct group)
 #define CLEN (szs.num_child_inputs * sizeof (void *))
 #define LLEN ((szs.long_len + 1) * sizeof (struct option))
+#define SGLEN ((UCHAR_MAX + 1) * sizeof (struct group *))
+#define HLEN (hash_size * sizeof (unsigned))
 #define SLEN (szs.short_len + 1)
 
-  parser->storage = malloc (GLEN + CLEN + LLEN + SLEN);
+  /* Keep the hash table of long options at most half full.  */
+  for (hash_size = 1; hash_size <= 2 * szs.long_len; hash_size <<= 1)
+    ;
+
+  parser->storage = malloc (GLEN + CLEN + LLEN + SGLEN + HLEN + SLEN);
   if (! parser->storage)
     return ENOMEM;
 
   parser->groups = parser->storage;
   parser->child_inputs = parser->storage + GLEN;
   parser->long_opts = parser->storage + GLEN + CLEN;
-  parser->short_opts = parser->storage + GLEN + CLEN + LLEN;
+  parser->short_groups = parser->storage + GLEN + CLEN + LLEN;
+  parser->long_hash = parser->storage + GLEN + CLEN + LLEN + SGLEN;
+  parser->long_hash_size = hash_size;
+  parser->short_opts = parser->storage + GLEN + CLEN + LLEN + SGLEN + HLEN;
 
   memset (parser->child_inputs, 0, szs.num_child_inputs * sizeof (void *));
+  memset (parser->short_groups, 0, SGLEN + HLEN);
   parser_convert (parser, argp, flags);
 
   memset (&parser->state, 0, sizeof (struct argp_state));
@@ -756,20 +786,12 @@ parser_parse_opt (struct parser *parser, int opt, char *val)
   error_t err = EBADKEY;
 
   if (group_key == 0)
-    /* A short option.  By comparing OPT's position in SHORT_OPTS to the
-       various starting positions in each group's SHORT_END field, we can
-       determine which group OPT came from.  */
+    /* A short option.  SHORT_GROUPS tells which group OPT came from.  */
     {
-      struct group *group;
-      char *short_index = strchr (parser->short_opts, opt);
-
-      if (short_index)
-	for (group = parser->groups; group < parser->egroup; group++)
-	  if (group->short_end > short_index)
-	    {
-	      err = group_parse (group, &parser->state, opt, optarg);
-	      break;
-	    }
+      struct group *group = parser->short_groups[(unsigned char) opt];
+
+      if (group)
+	err = group_parse (group, &parser->state, opt, optarg);
     }
   else
     /* A long option.  We use shifts instead of masking for extracting
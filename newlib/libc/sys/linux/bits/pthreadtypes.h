@@ -49,6 +49,8 @@ typedef struct __pthread_attr_s
   int __stackaddr_set;
   void *__stackaddr;
   size_t __stacksize;
+  size_t __cpusetsize;
+  void *__cpuset;
 } pthread_attr_t;
 
 
@@ -115,6 +117,8 @@ typedef struct _pthread_rwlock_t
   _pthread_descr __rw_write_waiting;  /* Threads waiting for writing */
   int __rw_kind;                      /* Reader/Writer preference selection */
   int __rw_pshared;                   /* Shared between processes or not */
+  void *__rw_stripes;                 /* Reader counters of scalable locks */
+  long int __rw_wrstate;              /* Writer state of scalable locks */
 } pthread_rwlock_t;
 
 
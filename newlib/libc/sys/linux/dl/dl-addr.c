@@ -30,6 +30,9 @@ _dl_addr (const void *address, Dl_info *info)
   const ElfW(Sym) *symtab, *matchsym;
   const char *strtab;
   ElfW(Word) strtabsize;
+  int lockfree;
+
+  lockfree = _dl_load_read_begin ();
 
   /* Find the highest-addressed object that ADDRESS is not below.  */
   match = NULL;
@@ -55,7 +58,10 @@ _dl_addr (const void *address, Dl_info *info)
       }
 
   if (match == NULL)
-    return 0;
+    {
+      _dl_load_read_end (lockfree);
+      return 0;
+    }
 
   /* Now we know what object the address lies in.  */
   info->dli_fname = match->l_name;
@@ -97,5 +103,6 @@ _dl_addr (const void *address, Dl_info *info)
       info->dli_saddr = NULL;
     }
 
+  _dl_load_read_end (lockfree);
   return 1;
 }
@@ -80,6 +80,9 @@ _dl_close (void *_map)
       return;
     }
 
+  /* Objects are about to be unmapped; keep lock-free readers away.  */
+  _dl_load_write_begin ();
+
   list = map->l_initfini;
 
   /* Compute the new l_opencount values.  */
@@ -230,6 +233,7 @@ _dl_close (void *_map)
 	    _dl_loaded = imap->l_next;
 #endif
 	  --_dl_nloaded;
+	  ++_dl_load_subs;
 	  if (imap->l_next)
 	    imap->l_next->l_prev = imap->l_prev;
 
@@ -303,6 +307,8 @@ _dl_close (void *_map)
 
   free (list);
 
+  _dl_load_write_end ();
+
   /* Release the lock.  */
 #ifdef HAVE_DD_LOCK
     __lock_release(_dl_load_lock);
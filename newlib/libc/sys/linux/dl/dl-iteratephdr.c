@@ -21,7 +21,141 @@
 #include <errno.h>
 #include <ldsodefs.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <sched.h>
 #include <bits/libc-lock.h>
+#include <atomicity.h>
+#include <libc-tsd.h>
+
+/* The unwinder calls dl_iterate_phdr for every frame of every thrown
+   exception, so it must not serialize threads on _dl_load_lock.
+
+   dlopen and dlclose change _dl_loaded with the lock held and bracket
+   the change with _dl_load_write_begin and _dl_load_write_end.  The
+   outermost begin makes _dl_load_gen odd and then waits until no
+   thread reads the list without the lock.  A reader announces itself
+   in _dl_load_readers and proceeds without the lock only if the
+   generation is even; otherwise it waits for the writer.  Both sides
+   use locked instructions, so either the reader sees the odd
+   generation or the writer sees the reader.
+
+   The writer waits for readers with the lock released: a reader may
+   call dlopen or dlclose from its dl_iterate_phdr callback, and it
+   then takes the lock and changes the list before the waiting writer
+   does.  Two readers doing that at once still wait for each other.  */
+
+/* Nesting of the writer holding _dl_load_lock, and the number of
+   threads between their outermost _dl_load_write_begin and
+   _dl_load_write_end, counting those waiting for readers.  Both are
+   protected by the lock.  */
+static unsigned int write_depth;
+static unsigned int writers;
+
+/* Number of lock-free reads this thread is nested in, so that a
+   dlopen or dlclose called from a dl_iterate_phdr callback does not
+   wait for itself.  */
+__libc_tsd_define (static, DL_READ_DEPTH)
+
+static inline uintptr_t
+get_read_depth (void)
+{
+  return (uintptr_t) __libc_tsd_get (DL_READ_DEPTH);
+}
+
+static inline void
+set_read_depth (uintptr_t depth)
+{
+  __libc_tsd_set (DL_READ_DEPTH, (void *) depth);
+}
+
+int
+internal_function
+_dl_load_read_begin (void)
+{
+  uintptr_t depth = get_read_depth ();
+
+  for (;;)
+    {
+      atomic_add (&_dl_load_readers, 1);
+      /* A nested read stays lock-free even if a writer started
+	 meanwhile: the writer waits for the outer read of this thread,
+	 so it has not changed the list yet.  */
+      if (depth > 0 || (_dl_load_gen & 1) == 0)
+	{
+	  set_read_depth (depth + 1);
+	  return 1;
+	}
+      atomic_add (&_dl_load_readers, -1);
+
+#ifdef HAVE_DD_LOCK
+      __lock_acquire_recursive(_dl_load_lock);
+#endif
+      /* WRITE_DEPTH is nonzero only while its writer holds the lock, so
+	 this thread is the writer, e.g. in a constructor run by dlopen.
+	 Read under the lock.  */
+      if (write_depth > 0)
+	return 0;
+      /* Another writer waits for older readers without the lock.  Do
+	 not add to them; try again once it is done.  */
+#ifdef HAVE_DD_LOCK
+      __lock_release_recursive(_dl_load_lock);
+#endif
+      sched_yield ();
+    }
+}
+
+void
+internal_function
+_dl_load_read_end (int lockfree)
+{
+  if (lockfree)
+    {
+      set_read_depth (get_read_depth () - 1);
+      atomic_add (&_dl_load_readers, -1);
+      return;
+    }
+
+#ifdef HAVE_DD_LOCK
+    __lock_release_recursive(_dl_load_lock);
+#endif
+}
+
+void
+internal_function
+_dl_load_write_begin (void)
+{
+  uintptr_t depth;
+
+  if (write_depth++ != 0)
+    return;
+  if (writers++ == 0)
+    atomic_add (&_dl_load_gen, 1);
+
+  /* Wait for the readers that came first, except this thread.  dlopen
+     and dlclose hold the lock once here; let go of it meanwhile, so
+     that such a reader can still call them.  */
+  depth = get_read_depth ();
+  while (_dl_load_readers > depth)
+    {
+      --write_depth;
+#ifdef HAVE_DD_LOCK
+      __lock_release_recursive(_dl_load_lock);
+#endif
+      sched_yield ();
+#ifdef HAVE_DD_LOCK
+      __lock_acquire_recursive(_dl_load_lock);
+#endif
+      ++write_depth;
+    }
+}
+
+void
+internal_function
+_dl_load_write_end (void)
+{
+  if (--write_depth == 0 && --writers == 0)
+    atomic_add (&_dl_load_gen, 1);
+}
 
 int
 __dl_iterate_phdr (int (*callback) (struct dl_phdr_info *info,
@@ -30,13 +164,12 @@ __dl_iterate_phdr (int (*callback) (struct dl_phdr_info *info,
   struct link_map *l;
   struct dl_phdr_info info;
   int ret = 0;
+  int lockfree;
 
-  /* Make sure we are alone.  */
-#ifdef HAVE_DD_LOCK
-    __lock_acquire(_dl_load_lock);
-#endif
-
+  lockfree = _dl_load_read_begin ();
 
+  info.dlpi_adds = _dl_load_adds;
+  info.dlpi_subs = _dl_load_subs;
   for (l = _dl_loaded; l != NULL; l = l->l_next)
     {
       /* Skip the dynamic linker.  */
@@ -51,11 +184,7 @@ __dl_iterate_phdr (int (*callback) (struct dl_phdr_info *info,
 	break;
     }
 
-  /* Release the lock.  */
-#ifdef HAVE_DD_LOCK
-    __lock_release(_dl_load_lock);
-#endif
-
+  _dl_load_read_end (lockfree);
 
   return ret;
 }
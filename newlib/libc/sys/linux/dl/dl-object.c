@@ -79,6 +79,7 @@ _dl_new_object (char *realname, const char *libname, int type,
   else
     _dl_loaded = new;
   ++_dl_nloaded;
+  ++_dl_load_adds;
 
   /* If we have no loader the new object acts as it.  */
   if (loader == NULL)
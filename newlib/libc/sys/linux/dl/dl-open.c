@@ -389,6 +389,7 @@ _dl_open (const char *file, int mode, const void *caller)
 #ifdef HAVE_DD_LOCK
     __lock_acquire_recursive(_dl_load_lock);
 #endif
+  _dl_load_write_begin ();
 
   args.file = file;
   args.mode = mode;
@@ -401,6 +402,8 @@ _dl_open (const char *file, int mode, const void *caller)
   _dl_unload_cache ();
 #endif
 
+  _dl_load_write_end ();
+
   /* Release the lock.  */
 #ifdef HAVE_DD_LOCK
     __lock_release_recursive(_dl_load_lock);
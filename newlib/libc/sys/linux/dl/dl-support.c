@@ -79,6 +79,15 @@ int _dl_bind_not;
 struct link_map *_dl_loaded;
 /* Number of object in the _dl_loaded list.  */
 unsigned int _dl_nloaded;
+/* Number of objects ever added to and removed from _dl_loaded.  */
+unsigned long long int _dl_load_adds;
+unsigned long long int _dl_load_subs;
+
+/* Generation of the _dl_loaded list, odd while dlopen or dlclose
+   change it or wait to, and the number of threads reading it without
+   holding _dl_load_lock.  See dl-iteratephdr.c.  */
+volatile uint32_t _dl_load_gen;
+volatile uint32_t _dl_load_readers;
 
 /* Fake scope.  In dynamically linked binaries this is the scope of the
    main application but here we don't have something like this.  So
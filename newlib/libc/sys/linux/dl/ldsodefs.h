@@ -406,6 +406,25 @@ extern struct link_map _dl_rtld_map;
 extern struct link_map *_dl_loaded;
 /* Number of object in the _dl_loaded list.  */
 extern unsigned int _dl_nloaded;
+/* Number of objects ever added to and removed from _dl_loaded.  */
+extern unsigned long long int _dl_load_adds;
+extern unsigned long long int _dl_load_subs;
+/* Generation of _dl_loaded, odd while a writer changes it or waits to.  */
+extern volatile uint32_t _dl_load_gen;
+/* Number of threads reading _dl_loaded without _dl_load_lock.  */
+extern volatile uint32_t _dl_load_readers;
+
+/* Readers of _dl_loaded call _dl_load_read_begin first.  It returns
+   nonzero if the list may be read without the lock and otherwise
+   returns with _dl_load_lock held.  Pass the result to
+   _dl_load_read_end when done.  */
+extern int _dl_load_read_begin (void) internal_function;
+extern void _dl_load_read_end (int __lockfree) internal_function;
+/* Bracket changes of _dl_loaded and the objects on it; called with
+   _dl_load_lock held once.  The outermost begin releases the lock
+   while it waits for lock-free readers.  */
+extern void _dl_load_write_begin (void) internal_function;
+extern void _dl_load_write_end (void) internal_function;
 /* Array representing global scope.  */
 extern struct r_scope_elem *_dl_global_scope[2];
 /* Direct pointer to the searchlist of the main object.  */
@@ -113,3 +113,48 @@ BUILTIN_TRANSFORMATION ("INTERNAL", "UNICODEBIG//", 1,
 			"=INTERNAL->ucs2reverse",
 			__gconv_transform_internal_ucs2reverse, 4, 4, 2, 2)
 #endif
+
+
+/* Fused steps for common pairs of external character sets.  They are
+   cheaper than the two steps through INTERNAL.  */
+BUILTIN_ALIAS ("ISO-IR-100//", "ISO-8859-1//")
+BUILTIN_ALIAS ("ISO_8859-1:1987//", "ISO-8859-1//")
+BUILTIN_ALIAS ("ISO_8859-1//", "ISO-8859-1//")
+BUILTIN_ALIAS ("ISO8859-1//", "ISO-8859-1//")
+BUILTIN_ALIAS ("ISO88591//", "ISO-8859-1//")
+BUILTIN_ALIAS ("LATIN1//", "ISO-8859-1//")
+BUILTIN_ALIAS ("L1//", "ISO-8859-1//")
+BUILTIN_ALIAS ("IBM819//", "ISO-8859-1//")
+BUILTIN_ALIAS ("CP819//", "ISO-8859-1//")
+BUILTIN_ALIAS ("CSISOLATIN1//", "ISO-8859-1//")
+BUILTIN_ALIAS ("8859_1//", "ISO-8859-1//")
+BUILTIN_ALIAS ("OSF00010001//", "ISO-8859-1//")
+
+BUILTIN_TRANSFORMATION ("ISO-10646/UTF8/", "ISO-8859-1//", 1, "=utf8->latin1",
+			__gconv_transform_utf8_latin1, 1, 6, 1, 1)
+
+BUILTIN_TRANSFORMATION ("ISO-8859-1//", "ISO-10646/UTF8/", 1, "=latin1->utf8",
+			__gconv_transform_latin1_utf8, 1, 1, 1, 2)
+
+BUILTIN_TRANSFORMATION ("ISO-10646/UTF8/", "ANSI_X3.4-1968//", 1,
+			"=utf8->ascii",
+			__gconv_transform_utf8_ascii, 1, 6, 1, 1)
+
+BUILTIN_TRANSFORMATION ("ANSI_X3.4-1968//", "ISO-10646/UTF8/", 1,
+			"=ascii->utf8",
+			__gconv_transform_ascii_utf8, 1, 1, 1, 1)
+
+BUILTIN_ALIAS ("UTF16LE//", "UTF-16LE//")
+BUILTIN_ALIAS ("UTF16BE//", "UTF-16BE//")
+
+BUILTIN_TRANSFORMATION ("ISO-10646/UTF8/", "UTF-16LE//", 1, "=utf8->utf16le",
+			__gconv_transform_utf8_utf16le, 1, 6, 2, 4)
+
+BUILTIN_TRANSFORMATION ("UTF-16LE//", "ISO-10646/UTF8/", 1, "=utf16le->utf8",
+			__gconv_transform_utf16le_utf8, 2, 4, 1, 4)
+
+BUILTIN_TRANSFORMATION ("ISO-10646/UTF8/", "UTF-16BE//", 1, "=utf8->utf16be",
+			__gconv_transform_utf8_utf16be, 1, 6, 2, 4)
+
+BUILTIN_TRANSFORMATION ("UTF-16BE//", "ISO-10646/UTF8/", 1, "=utf16be->utf8",
+			__gconv_transform_utf16be_utf8, 2, 4, 1, 4)
@@ -28,6 +28,7 @@
 #include <dlfcn.h>
 #include <gconv_int.h>
 #include <gconv_charset.h>
+#include "hash-string.h"
 
 
 /* Simple data structure for alias mapping.  We have two names, `from'
@@ -83,58 +84,106 @@ struct known_derivation
 {
   const char *from;
   const char *to;
+  int flags;
+  unsigned long int hval;
+  struct known_derivation *next;
   struct __gconv_step *steps;
   size_t nsteps;
 };
 
-/* Compare function for database of found derivations.  */
-static int
-derivation_compare (const void *p1, const void *p2)
-{
-  const struct known_derivation *s1 = (const struct known_derivation *) p1;
-  const struct known_derivation *s2 = (const struct known_derivation *) p2;
-  int result;
+/* The hash table for known derivations, with separate chaining.  Its size
+   is a power of two and it is doubled when the chains get longer than two
+   entries on average.  */
+static struct known_derivation **known_derivations;
+static size_t known_derivations_size;
+static size_t known_derivations_count;
 
-  result = strcmp (s1->from, s2->from);
-  if (result == 0)
-    result = strcmp (s1->to, s2->to);
-  return result;
-}
+/* Only these flags change the result of `find_derivation'.  */
+#define DERIVATION_FLAGS GCONV_AVOID_FUSED
 
-/* The search tree for known derivations.  */
-static void *known_derivations;
+static unsigned long int
+internal_function
+derivation_hash (const char *fromset, const char *toset, int flags)
+{
+  return hash_string (fromset) * 31 + hash_string (toset) + flags;
+}
 
-/* Look up whether given transformation was already requested before.  */
+/* Look whether given transformation was already requested before.  */
 static int
 internal_function
-derivation_lookup (const char *fromset, const char *toset,
-		   struct __gconv_step **handle, size_t *nsteps)
+derivation_lookup (const char *fromset, const char *toset, int flags,
+		   unsigned long int hval, struct __gconv_step **handle,
+		   size_t *nsteps)
 {
-  struct known_derivation key = { fromset, toset, NULL, 0 };
-  struct known_derivation **result;
+  struct known_derivation *runp;
 
-  result = tfind (&key, &known_derivations, derivation_compare);
-
-  if (result == NULL)
+  if (known_derivations == NULL)
     return __GCONV_NOCONV;
 
-  *handle = (*result)->steps;
-  *nsteps = (*result)->nsteps;
+  for (runp = known_derivations[hval & (known_derivations_size - 1)];
+       runp != NULL; runp = runp->next)
+    if (runp->hval == hval && runp->flags == flags
+	&& strcmp (runp->from, fromset) == 0
+	&& strcmp (runp->to, toset) == 0)
+      {
+	*handle = runp->steps;
+	*nsteps = runp->nsteps;
+
+	/* Please note that we return GCONV_OK even if the last search for
+	   this transformation was unsuccessful.  */
+	return __GCONV_OK;
+      }
+
+  return __GCONV_NOCONV;
+}
+
+/* Double the size of the hash table, or create it.  */
+static int
+internal_function
+grow_derivations (void)
+{
+  size_t new_size = known_derivations_size ? 2 * known_derivations_size : 16;
+  struct known_derivation **new_table;
+  size_t cnt;
 
-  /* Please note that we return GCONV_OK even if the last search for
-     this transformation was unsuccessful.  */
-  return __GCONV_OK;
+  new_table = (struct known_derivation **)
+    calloc (new_size, sizeof (struct known_derivation *));
+  if (new_table == NULL)
+    return -1;
+
+  for (cnt = 0; cnt < known_derivations_size; ++cnt)
+    while (known_derivations[cnt] != NULL)
+      {
+	struct known_derivation *runp = known_derivations[cnt];
+	size_t idx = runp->hval & (new_size - 1);
+
+	known_derivations[cnt] = runp->next;
+	runp->next = new_table[idx];
+	new_table[idx] = runp;
+      }
+
+  free (known_derivations);
+  known_derivations = new_table;
+  known_derivations_size = new_size;
+  return 0;
 }
 
 /* Add new derivation to list of known ones.  */
 static void
 internal_function
-add_derivation (const char *fromset, const char *toset,
-		struct __gconv_step *handle, size_t nsteps)
+add_derivation (const char *fromset, const char *toset, int flags,
+		unsigned long int hval, struct __gconv_step *handle,
+		size_t nsteps)
 {
   struct known_derivation *new_deriv;
   size_t fromset_len = strlen (fromset) + 1;
   size_t toset_len = strlen (toset) + 1;
+  size_t idx;
+
+  /* A full table is still usable, only slower.  */
+  if (known_derivations_count >= 2 * known_derivations_size
+      && grow_derivations () != 0 && known_derivations == NULL)
+    return;
 
   new_deriv = (struct known_derivation *)
     malloc (sizeof (struct known_derivation) + fromset_len + toset_len);
@@ -148,13 +197,15 @@ add_derivation (const char *fromset, const char *toset,
       new_deriv->to = memcpy (tmp,
 			      toset, toset_len);
 
+      new_deriv->flags = flags;
+      new_deriv->hval = hval;
       new_deriv->steps = handle;
       new_deriv->nsteps = nsteps;
 
-      if (tsearch (new_deriv, &known_derivations, derivation_compare)
-	  == NULL)
-	/* There is some kind of memory allocation problem.  */
-	free (new_deriv);
+      idx = hval & (known_derivations_size - 1);
+      new_deriv->next = known_derivations[idx];
+      known_derivations[idx] = new_deriv;
+      ++known_derivations_count;
     }
   /* Please note that we don't complain if the allocation failed.  This
      is not tragically but in case we use the memory debugging facilities
@@ -172,15 +223,30 @@ free_derivation (void *p)
 	&& deriv->steps[cnt].__end_fct != NULL)
       deriv->steps[cnt].__end_fct (&deriv->steps[cnt]);
 
-  /* Free the name strings.  */
-  free ((char *) deriv->steps[0].__from_name);
-  free ((char *) deriv->steps[deriv->nsteps - 1].__to_name);
+  /* Free the name strings.  Failed searches have no steps.  */
+  if (deriv->nsteps > 0)
+    {
+      free ((char *) deriv->steps[0].__from_name);
+      free ((char *) deriv->steps[deriv->nsteps - 1].__to_name);
+    }
 
   free ((struct __gconv_step *) deriv->steps);
   free (deriv);
 }
 
 
+/* A builtin module which converts between two external character sets
+   without going through INTERNAL does the work of two steps at once.  */
+static int
+internal_function
+fused_module_p (const struct gconv_module *module)
+{
+  return (module->module_name[0] == '='
+	  && strcmp (module->from_string, "INTERNAL") != 0
+	  && strcmp (module->to_string, "INTERNAL") != 0);
+}
+
+
 /* Decrement the reference count for a single step in a steps array.  */
 void
 internal_function
@@ -359,17 +425,21 @@ static int
 internal_function
 find_derivation (const char *toset, const char *toset_expand,
 		 const char *fromset, const char *fromset_expand,
-		 struct __gconv_step **handle, size_t *nsteps)
+		 struct __gconv_step **handle, size_t *nsteps, int flags)
 {
   struct derivation_step *first, *current, **lastp, *solution = NULL;
   int best_cost_hi = INT_MAX;
   int best_cost_lo = INT_MAX;
+  unsigned long int hval;
   int result;
 
   /* Look whether an earlier call to `find_derivation' has already
      computed a possible derivation.  If so, return it immediately.  */
+  flags &= DERIVATION_FLAGS;
+  hval = derivation_hash (fromset_expand ?: fromset, toset_expand ?: toset,
+			  flags);
   result = derivation_lookup (fromset_expand ?: fromset, toset_expand ?: toset,
-			      handle, nsteps);
+			      flags, hval, handle, nsteps);
   if (result == __GCONV_OK)
     {
 #ifndef STATIC_GCONV
@@ -459,6 +529,14 @@ find_derivation (const char *toset, const char *toset_expand,
 		  int cost_lo = runp->cost_lo + current->cost_lo;
 		  struct derivation_step *step;
 
+		  /* Transliteration only works on INTERNAL input, so a
+		     fused step must not hide that character set.  */
+		  if ((flags & GCONV_AVOID_FUSED) && fused_module_p (runp))
+		    {
+		      runp = runp->same;
+		      continue;
+		    }
+
 		  /* We managed to find a derivation.  First see whether
 		     we have reached one of the goal nodes.  */
 		  if (strcmp (result_set, toset) == 0
@@ -613,7 +691,7 @@ find_derivation (const char *toset, const char *toset_expand,
 
   /* Add result in any case to list of known derivations.  */
   add_derivation (fromset_expand ?: fromset, toset_expand ?: toset,
-		  *handle, *nsteps);
+		  flags, hval, *handle, *nsteps);
 
   return result;
 }
@@ -714,7 +792,13 @@ __gconv_find_transform (const char *toset, const char *fromset,
     }
 
   result = find_derivation (toset, toset_expand, fromset, fromset_expand,
-			    handle, nsteps);
+			    handle, nsteps, flags);
+  if (__builtin_expect (flags & GCONV_AVOID_FUSED, 0)
+      && (result == __GCONV_NOCONV
+	  || (result == __GCONV_OK && *handle == NULL)))
+    /* A fused step without transliteration is better than nothing.  */
+    result = find_derivation (toset, toset_expand, fromset, fromset_expand,
+			      handle, nsteps, flags & ~GCONV_AVOID_FUSED);
 
   /* Release the lock.  */
 #ifdef HAVE_DD_LOCK
@@ -797,7 +881,19 @@ free_mem (void)
     free_modules_db (__gconv_modules_db);
 
   if (known_derivations != NULL)
-    tdestroy (known_derivations, free_derivation);
+    {
+      size_t cnt;
+
+      for (cnt = 0; cnt < known_derivations_size; ++cnt)
+	while (known_derivations[cnt] != NULL)
+	  {
+	    struct known_derivation *runp = known_derivations[cnt];
+
+	    known_derivations[cnt] = runp->next;
+	    free_derivation (runp);
+	  }
+      free (known_derivations);
+    }
 }
 
 text_set_element (__libc_subfreeres, free_mem);
@@ -108,7 +108,9 @@ struct trans_struct
 /* Flags for `gconv_open'.  */
 enum
 {
-  GCONV_AVOID_NOCONV = 1 << 0
+  GCONV_AVOID_NOCONV = 1 << 0,
+  /* Used internally when transliteration is requested.  */
+  GCONV_AVOID_FUSED = 1 << 1
 };
 
 
@@ -279,6 +281,14 @@ __BUILTIN_TRANS (__gconv_transform_internal_ucs4le);
 __BUILTIN_TRANS (__gconv_transform_ucs4le_internal);
 __BUILTIN_TRANS (__gconv_transform_internal_utf16);
 __BUILTIN_TRANS (__gconv_transform_utf16_internal);
+__BUILTIN_TRANS (__gconv_transform_utf8_latin1);
+__BUILTIN_TRANS (__gconv_transform_latin1_utf8);
+__BUILTIN_TRANS (__gconv_transform_utf8_ascii);
+__BUILTIN_TRANS (__gconv_transform_ascii_utf8);
+__BUILTIN_TRANS (__gconv_transform_utf8_utf16le);
+__BUILTIN_TRANS (__gconv_transform_utf16le_utf8);
+__BUILTIN_TRANS (__gconv_transform_utf8_utf16be);
+__BUILTIN_TRANS (__gconv_transform_utf16be_utf8);
 # undef __BUITLIN_TRANS
 
 #endif
@@ -158,6 +158,11 @@ __gconv_open (const char *toset, const char *fromset, __gconv_t *handle,
       fromset = memcpy (newfromset, fromset, ignore - fromset);
     }
 
+  /* The transliteration functions work on the internal representation,
+     so do not let a fused step skip it.  */
+  if (trans != NULL)
+    flags |= GCONV_AVOID_FUSED;
+
   res = __gconv_find_transform (toset, fromset, &steps, &nsteps, flags);
   if (res == __GCONV_OK)
     {
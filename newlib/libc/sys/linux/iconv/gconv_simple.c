@@ -845,36 +845,26 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #include <iconv/skeleton.c>
 
 
-/* Convert from the internal (UCS4-like) format to UTF-8.  */
-#define DEFINE_INIT		0
-#define DEFINE_FINI		0
-#define MIN_NEEDED_FROM		4
-#define MIN_NEEDED_TO		1
-#define MAX_NEEDED_TO		6
-#define FROM_DIRECTION		1
-#define FROM_LOOP		internal_utf8_loop
-#define TO_LOOP			internal_utf8_loop /* This is not used.  */
-#define FUNCTION_NAME		__gconv_transform_internal_utf8
-#define ONE_DIRECTION		1
+/* The UTF-8 encoder and decoder are shared by the steps to and from the
+   internal format and the fused steps below, which convert directly
+   between UTF-8 and another external character set.
 
-#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
-#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
-#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
-#define LOOPFCT			FROM_LOOP
-#define BODY \
+   UTF8_PUT stores WC, which must not be larger than 0x7fffffff.  It
+   leaves the loop with __GCONV_FULL_OUTPUT if the sequence does not fit.  */
+#define UTF8_PUT(Wc) \
   {									      \
-    uint32_t wc = *((const uint32_t *) inptr);				      \
+    uint32_t __wc = (Wc);						      \
 									      \
-    if (wc < 0x80)							      \
+    if (__wc < 0x80)							      \
       /* It's an one byte sequence.  */					      \
-      *outptr++ = (unsigned char) wc;					      \
-    else if (__builtin_expect (wc <= 0x7fffffff, 1))			      \
+      *outptr++ = (unsigned char) __wc;					      \
+    else								      \
       {									      \
 	size_t step;							      \
-	char *start;							      \
+	unsigned char *start;						      \
 									      \
 	for (step = 2; step < 6; ++step)				      \
-	  if ((wc & (~(uint32_t)0 << (5 * step + 1))) == 0)		      \
+	  if ((__wc & (~(uint32_t)0 << (5 * step + 1))) == 0)		      \
 	    break;							      \
 									      \
 	if (__builtin_expect (outptr + step > outend, 0))		      \
@@ -890,45 +880,53 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 	--step;								      \
 	do								      \
 	  {								      \
-	    start[step] = 0x80 | (wc & 0x3f);				      \
-	    wc >>= 6;							      \
+	    start[step] = 0x80 | (__wc & 0x3f);				      \
+	    __wc >>= 6;							      \
 	  }								      \
 	while (--step > 0);						      \
-	start[0] |= wc;							      \
-      }									      \
-    else								      \
-      {									      \
-	STANDARD_ERR_HANDLER (4);					      \
+	start[0] |= __wc;						      \
       }									      \
-									      \
-    inptr += 4;								      \
   }
-#define LOOP_NEED_FLAGS
-#include <iconv/loop.c>
-#include <iconv/skeleton.c>
-
 
-/* Convert from UTF-8 to the internal (UCS4-like) format.  */
+/* Convert from the internal (UCS4-like) format to UTF-8.  */
 #define DEFINE_INIT		0
 #define DEFINE_FINI		0
-#define MIN_NEEDED_FROM		1
-#define MAX_NEEDED_FROM		6
-#define MIN_NEEDED_TO		4
+#define MIN_NEEDED_FROM		4
+#define MIN_NEEDED_TO		1
+#define MAX_NEEDED_TO		6
 #define FROM_DIRECTION		1
-#define FROM_LOOP		utf8_internal_loop
-#define TO_LOOP			utf8_internal_loop /* This is not used.  */
-#define FUNCTION_NAME		__gconv_transform_utf8_internal
+#define FROM_LOOP		internal_utf8_loop
+#define TO_LOOP			internal_utf8_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_internal_utf8
 #define ONE_DIRECTION		1
 
 #define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
-#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
 #define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
 #define LOOPFCT			FROM_LOOP
 #define BODY \
   {									      \
-    uint32_t ch;							      \
-    uint32_t cnt;							      \
-    uint32_t i;							      \
+    uint32_t wc = *((const uint32_t *) inptr);				      \
+									      \
+    if (__builtin_expect (wc > 0x7fffffff, 0))				      \
+      {									      \
+	STANDARD_ERR_HANDLER (4);					      \
+      }									      \
+									      \
+    UTF8_PUT (wc);							      \
+    inptr += 4;								      \
+  }
+#define LOOP_NEED_FLAGS
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* UTF8_GET decodes the character at INPTR into `ch' and its length in
+   bytes into `cnt', both of type uint32_t, without consuming it.  Invalid
+   sequences are skipped or leave the loop, as for the other errors.  */
+#define UTF8_GET \
+  {									      \
+    uint32_t i;								      \
 									      \
     /* Next input byte.  */						      \
     ch = *inptr;							      \
@@ -937,7 +935,6 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
       {									      \
 	/* One byte sequence.  */					      \
 	cnt = 1;							      \
-	++inptr;							      \
       }									      \
     else								      \
       {									      \
@@ -1052,17 +1049,12 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 	    result = __GCONV_ILLEGAL_INPUT;				      \
 	    break;							      \
 	  }								      \
-									      \
-	inptr += cnt;							      \
       }									      \
-									      \
-    /* Now adjust the pointers and store the result.  */		      \
-    *((uint32_t *) outptr) = ch;					      \
-    outptr = (unsigned char *)((uint32_t *) outptr + 1);		      \
   }
-#define LOOP_NEED_FLAGS
 
-#define STORE_REST \
+/* Both macros are used for UTF8_GET in the `single' functions, which
+   handle characters split between two calls.  */
+#define UTF8_STORE_REST \
   {									      \
     /* We store the remaining bytes while converting them into the UCS4	      \
        format.  We can assume that the first byte in the buffer is	      \
@@ -1122,7 +1114,7 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
     state->__value.__wch = ch;						      \
   }
 
-#define UNPACK_BYTES \
+#define UTF8_UNPACK_BYTES \
   {									      \
     wint_t wch = state->__value.__wch;					      \
     size_t ntotal;							      \
@@ -1165,6 +1157,40 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
     bytebuf[0] |= wch;							      \
   }
 
+
+/* Convert from UTF-8 to the internal (UCS4-like) format.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MAX_NEEDED_FROM		6
+#define MIN_NEEDED_TO		4
+#define FROM_DIRECTION		1
+#define FROM_LOOP		utf8_internal_loop
+#define TO_LOOP			utf8_internal_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_utf8_internal
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY \
+  {									      \
+    uint32_t ch;							      \
+    uint32_t cnt;							      \
+									      \
+    UTF8_GET;								      \
+									      \
+    /* Now adjust the pointers and store the result.  */		      \
+    *((uint32_t *) outptr) = ch;					      \
+    outptr = (unsigned char *)((uint32_t *) outptr + 1);		      \
+    inptr += cnt;							      \
+  }
+#define LOOP_NEED_FLAGS
+
+#define STORE_REST		UTF8_STORE_REST
+#define UNPACK_BYTES		UTF8_UNPACK_BYTES
+
 #include <iconv/loop.c>
 #include <iconv/skeleton.c>
 
@@ -1352,3 +1378,344 @@ ucs4le_internal_loop_single (struct __gconv_step *step,
 #define LOOP_NEED_FLAGS
 #include <iconv/loop.c>
 #include <iconv/skeleton.c>
+
+
+/* The remaining steps convert directly between UTF-8 and another external
+   character set, without going through the internal format.  They are
+   preferred to the two steps via INTERNAL because of their lower cost,
+   but cannot be combined with transliteration.  */
+
+/* Convert from UTF-8 to an 8-bit character set whose characters are the
+   first LIMIT + 1 characters of ISO 10646.  */
+#define UTF8_TO_BYTE_BODY(Limit) \
+  {									      \
+    uint32_t ch;							      \
+    uint32_t cnt;							      \
+									      \
+    UTF8_GET;								      \
+									      \
+    if (__builtin_expect (ch > (Limit), 0))				      \
+      {									      \
+	UNICODE_TAG_HANDLER (ch, cnt);					      \
+	STANDARD_ERR_HANDLER (cnt);					      \
+      }									      \
+									      \
+    *outptr++ = (unsigned char) ch;					      \
+    inptr += cnt;							      \
+  }
+
+/* Convert from such a character set to UTF-8.  */
+#define BYTE_TO_UTF8_BODY(Limit) \
+  {									      \
+    uint32_t ch = *inptr;						      \
+									      \
+    if (__builtin_expect (ch > (Limit), 0))				      \
+      {									      \
+	/* This is no correct character of the character set.  As for	      \
+	   ASCII to INTERNAL, this is a bug in the input.  */		      \
+	if (! ignore_errors_p ())					      \
+	  {								      \
+	    result = __GCONV_ILLEGAL_INPUT;				      \
+	    break;							      \
+	  }								      \
+									      \
+	*irreversible = *irreversible + 1;				      \
+	++inptr;							      \
+	continue;							      \
+      }									      \
+									      \
+    UTF8_PUT (ch);							      \
+    ++inptr;								      \
+  }
+
+
+/* Convert from UTF-8 to ISO 8859-1.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MAX_NEEDED_FROM		6
+#define MIN_NEEDED_TO		1
+#define FROM_DIRECTION		1
+#define FROM_LOOP		utf8_latin1_loop
+#define TO_LOOP			utf8_latin1_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_utf8_latin1
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY			UTF8_TO_BYTE_BODY (0xff)
+#define LOOP_NEED_FLAGS
+
+#define STORE_REST		UTF8_STORE_REST
+#define UNPACK_BYTES		UTF8_UNPACK_BYTES
+
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* Convert from ISO 8859-1 to UTF-8.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MIN_NEEDED_TO		1
+#define MAX_NEEDED_TO		2
+#define FROM_DIRECTION		1
+#define FROM_LOOP		latin1_utf8_loop
+#define TO_LOOP			latin1_utf8_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_latin1_utf8
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY			BYTE_TO_UTF8_BODY (0xff)
+#define LOOP_NEED_FLAGS
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* Convert from UTF-8 to ISO 646-IRV.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MAX_NEEDED_FROM		6
+#define MIN_NEEDED_TO		1
+#define FROM_DIRECTION		1
+#define FROM_LOOP		utf8_ascii_loop
+#define TO_LOOP			utf8_ascii_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_utf8_ascii
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY			UTF8_TO_BYTE_BODY (0x7f)
+#define LOOP_NEED_FLAGS
+
+#define STORE_REST		UTF8_STORE_REST
+#define UNPACK_BYTES		UTF8_UNPACK_BYTES
+
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* Convert from ISO 646-IRV to UTF-8.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MIN_NEEDED_TO		1
+#define FROM_DIRECTION		1
+#define FROM_LOOP		ascii_utf8_loop
+#define TO_LOOP			ascii_utf8_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_ascii_utf8
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY			BYTE_TO_UTF8_BODY (0x7f)
+#define LOOP_NEED_FLAGS
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* UTF-16 with a fixed byte order, accessed bytewise so that neither the
+   alignment nor the byte order of the machine matter.  */
+#define get16le(addr) ((addr)[0] | (addr)[1] << 8)
+#define get16be(addr) ((addr)[0] << 8 | (addr)[1])
+#define put16le(addr, val) \
+  ((addr)[0] = (unsigned char) (val), (addr)[1] = (unsigned char) ((val) >> 8))
+#define put16be(addr, val) \
+  ((addr)[0] = (unsigned char) ((val) >> 8), (addr)[1] = (unsigned char) (val))
+
+/* Convert from UTF-8 to UTF-16, storing the words with PUT.  */
+#define UTF8_TO_UTF16_BODY(Put) \
+  {									      \
+    uint32_t ch;							      \
+    uint32_t cnt;							      \
+									      \
+    UTF8_GET;								      \
+									      \
+    if (__builtin_expect (ch >= 0xd800 && ch < 0xe000, 0))		      \
+      {									      \
+	/* Surrogate characters are not valid in UTF-8 input.  Neither	      \
+	   may they be passed through to the UTF-16 output.  */		      \
+	STANDARD_ERR_HANDLER (cnt);					      \
+      }									      \
+									      \
+    if (__builtin_expect (ch < 0x10000, 1))				      \
+      {									      \
+	Put (outptr, ch);						      \
+	outptr += 2;							      \
+      }									      \
+    else if (__builtin_expect (ch < 0x110000, 1))			      \
+      {									      \
+	/* Generate a surrogate pair.  */				      \
+	if (__builtin_expect (outptr + 4 > outend, 0))			      \
+	  {								      \
+	    /* Overflow in the output buffer.  */			      \
+	    result = __GCONV_FULL_OUTPUT;				      \
+	    break;							      \
+	  }								      \
+									      \
+	Put (outptr, 0xd7c0 + (ch >> 10));				      \
+	Put (outptr + 2, 0xdc00 + (ch & 0x3ff));			      \
+	outptr += 4;							      \
+      }									      \
+    else								      \
+      {									      \
+	STANDARD_ERR_HANDLER (cnt);					      \
+      }									      \
+									      \
+    inptr += cnt;							      \
+  }
+
+/* Convert from UTF-16 to UTF-8, reading the words with GET.  */
+#define UTF16_TO_UTF8_BODY(Get) \
+  {									      \
+    uint32_t u1 = Get (inptr);						      \
+									      \
+    if (__builtin_expect (u1 < 0xd800, 1) || u1 > 0xdfff)		      \
+      {									      \
+	/* No surrogate.  */						      \
+	UTF8_PUT (u1);							      \
+	inptr += 2;							      \
+      }									      \
+    else								      \
+      {									      \
+	uint32_t u2;							      \
+									      \
+	/* A low surrogate cannot start a character.  */		      \
+	if (__builtin_expect (u1 >= 0xdc00, 0))				      \
+	  {								      \
+	    STANDARD_ERR_HANDLER (2);					      \
+	  }								      \
+									      \
+	if (__builtin_expect (inptr + 4 > inend, 0))			      \
+	  {								      \
+	    /* We don't have enough input for another complete input	      \
+	       character.  */						      \
+	    result = __GCONV_INCOMPLETE_INPUT;				      \
+	    break;							      \
+	  }								      \
+									      \
+	u2 = Get (inptr + 2);						      \
+	if (__builtin_expect (u2 < 0xdc00, 0)				      \
+	    || __builtin_expect (u2 > 0xdfff, 0))			      \
+	  {								      \
+	    /* This is no valid second word for a surrogate.  */	      \
+	    STANDARD_ERR_HANDLER (2);					      \
+	  }								      \
+									      \
+	UTF8_PUT (((u1 - 0xd7c0) << 10) + (u2 - 0xdc00));		      \
+	inptr += 4;							      \
+      }									      \
+  }
+
+
+/* Convert from UTF-8 to UTF-16LE.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MAX_NEEDED_FROM		6
+#define MIN_NEEDED_TO		2
+#define MAX_NEEDED_TO		4
+#define FROM_DIRECTION		1
+#define FROM_LOOP		utf8_utf16le_loop
+#define TO_LOOP			utf8_utf16le_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_utf8_utf16le
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY			UTF8_TO_UTF16_BODY (put16le)
+#define LOOP_NEED_FLAGS
+
+#define STORE_REST		UTF8_STORE_REST
+#define UNPACK_BYTES		UTF8_UNPACK_BYTES
+
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* Convert from UTF-16LE to UTF-8.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		2
+#define MAX_NEEDED_FROM		4
+#define MIN_NEEDED_TO		1
+#define MAX_NEEDED_TO		4
+#define FROM_DIRECTION		1
+#define FROM_LOOP		utf16le_utf8_loop
+#define TO_LOOP			utf16le_utf8_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_utf16le_utf8
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY			UTF16_TO_UTF8_BODY (get16le)
+#define LOOP_NEED_FLAGS
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* Convert from UTF-8 to UTF-16BE.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		1
+#define MAX_NEEDED_FROM		6
+#define MIN_NEEDED_TO		2
+#define MAX_NEEDED_TO		4
+#define FROM_DIRECTION		1
+#define FROM_LOOP		utf8_utf16be_loop
+#define TO_LOOP			utf8_utf16be_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_utf8_utf16be
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY			UTF8_TO_UTF16_BODY (put16be)
+#define LOOP_NEED_FLAGS
+
+#define STORE_REST		UTF8_STORE_REST
+#define UNPACK_BYTES		UTF8_UNPACK_BYTES
+
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
+
+
+/* Convert from UTF-16BE to UTF-8.  */
+#define DEFINE_INIT		0
+#define DEFINE_FINI		0
+#define MIN_NEEDED_FROM		2
+#define MAX_NEEDED_FROM		4
+#define MIN_NEEDED_TO		1
+#define MAX_NEEDED_TO		4
+#define FROM_DIRECTION		1
+#define FROM_LOOP		utf16be_utf8_loop
+#define TO_LOOP			utf16be_utf8_loop /* This is not used.  */
+#define FUNCTION_NAME		__gconv_transform_utf16be_utf8
+#define ONE_DIRECTION		1
+
+#define MIN_NEEDED_INPUT	MIN_NEEDED_FROM
+#define MAX_NEEDED_INPUT	MAX_NEEDED_FROM
+#define MIN_NEEDED_OUTPUT	MIN_NEEDED_TO
+#define MAX_NEEDED_OUTPUT	MAX_NEEDED_TO
+#define LOOPFCT			FROM_LOOP
+#define BODY			UTF16_TO_UTF8_BODY (get16be)
+#define LOOP_NEED_FLAGS
+#include <iconv/loop.c>
+#include <iconv/skeleton.c>
@@ -257,6 +257,12 @@ struct dl_phdr_info
     const char *dlpi_name;
     const ElfW(Phdr) *dlpi_phdr;
     ElfW(Half) dlpi_phnum;
+
+    /* Number of objects loaded into and unloaded from the process so
+       far.  Callers caching information about the objects can check
+       these for changes instead of walking all of them again.  */
+    unsigned long long int dlpi_adds;
+    unsigned long long int dlpi_subs;
   };
 
 extern int dl_iterate_phdr (int (*callback) (struct dl_phdr_info *info,
@@ -36,6 +36,41 @@
 /* Define the real names for the elements of `struct sched_param'.  */
 #define sched_priority	__sched_priority
 
+/* Older kernel headers do not describe CPU sets; use the kernel's
+   default mask size of 1024 CPUs.  */
+#ifndef __CPU_SETSIZE
+# define __CPU_SETSIZE	1024
+# define __NCPUBITS	(8 * sizeof (__cpu_mask))
+
+typedef unsigned long int __cpu_mask;
+
+# define __CPUELT(cpu)	((cpu) / __NCPUBITS)
+# define __CPUMASK(cpu)	((__cpu_mask) 1 << ((cpu) % __NCPUBITS))
+
+typedef struct
+{
+  __cpu_mask __bits[__CPU_SETSIZE / __NCPUBITS];
+} cpu_set_t;
+
+# define __CPU_ZERO(cpusetp) \
+  do {									      \
+    unsigned int __i;							      \
+    cpu_set_t *__arr = (cpusetp);					      \
+    for (__i = 0; __i < sizeof (cpu_set_t) / sizeof (__cpu_mask); ++__i)      \
+      __arr->__bits[__i] = 0;						      \
+  } while (0)
+# define __CPU_SET(cpu, cpusetp) \
+  ((cpusetp)->__bits[__CPUELT (cpu)] |= __CPUMASK (cpu))
+# define __CPU_CLR(cpu, cpusetp) \
+  ((cpusetp)->__bits[__CPUELT (cpu)] &= ~__CPUMASK (cpu))
+# define __CPU_ISSET(cpu, cpusetp) \
+  (((cpusetp)->__bits[__CPUELT (cpu)] & __CPUMASK (cpu)) != 0)
+#endif
+#ifndef __CPU_COUNT
+# define __CPU_COUNT(cpusetp) \
+  __sched_cpucount (sizeof (cpu_set_t), cpusetp)
+#endif
+
 
 __BEGIN_DECLS
 
@@ -65,6 +100,10 @@ extern int sched_get_priority_min (int __algorithm) __THROW;
 /* Get the SCHED_RR interval for the named process.  */
 extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __THROW;
 
+/* Count the CPUs in a set of SETSIZE bytes; used by CPU_COUNT.  */
+extern int __sched_cpucount (size_t __setsize, __const cpu_set_t *__setp)
+     __THROW;
+
 
 #ifdef __USE_GNU
 /* Access macros for `cpu_set'.  */
@@ -83,6 +122,9 @@ extern int sched_setaffinity (__pid_t __pid, size_t __cpusetsize,
 /* Get the CPU affinity for a task */
 extern int sched_getaffinity (__pid_t __pid, size_t __cpusetsize,
 			      cpu_set_t *__cpuset) __THROW;
+
+/* Get the number of the CPU the calling thread is running on.  */
+extern int sched_getcpu (void) __THROW;
 #endif
 
 __END_DECLS
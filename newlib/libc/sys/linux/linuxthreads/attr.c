@@ -15,6 +15,7 @@
 /* Handling of thread attributes */
 
 #include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/param.h>
@@ -36,6 +37,8 @@ int __pthread_attr_init_2_1(pthread_attr_t *attr)
   attr->__stackaddr = NULL;
   attr->__stackaddr_set = 0;
   attr->__stacksize = STACK_SIZE - ps;
+  attr->__cpusetsize = 0;
+  attr->__cpuset = NULL;
   return 0;
 }
 
@@ -58,6 +61,9 @@ compat_symbol (libpthread, __pthread_attr_init_2_0, pthread_attr_init,
 
 int pthread_attr_destroy(pthread_attr_t *attr)
 {
+  free (attr->__cpuset);
+  attr->__cpuset = NULL;
+  attr->__cpusetsize = 0;
   return 0;
 }
 
@@ -268,17 +274,36 @@ int pthread_getattr_np (pthread_t thread, pthread_attr_t *attr)
 
   descr = handle->h_descr;
 
+  /* Report the thread's current CPU affinity.  If the kernel cannot
+     give it to us, leave the set empty: the thread may run anywhere.  */
+  attr->__cpusetsize = 0;
+  attr->__cpuset = malloc (sizeof (cpu_set_t));
+  if (attr->__cpuset != NULL)
+    {
+      if (__sched_getaffinity (descr->p_pid, sizeof (cpu_set_t),
+			       attr->__cpuset) == 0)
+	attr->__cpusetsize = sizeof (cpu_set_t);
+      else
+	{
+	  free (attr->__cpuset);
+	  attr->__cpuset = NULL;
+	}
+    }
+
   attr->__detachstate = (descr->p_detached
 			 ? PTHREAD_CREATE_DETACHED
 			 : PTHREAD_CREATE_JOINABLE);
 
   attr->__schedpolicy = __sched_getscheduler (descr->p_pid);
-  if (attr->__schedpolicy == -1)
-    return errno;
+  if (attr->__schedpolicy == -1
+      || __sched_getparam (descr->p_pid,
+			   (struct sched_param *) &attr->__schedparam) != 0)
+    {
+      int err = errno;
 
-  if (__sched_getparam (descr->p_pid,
-			(struct sched_param *) &attr->__schedparam) != 0)
-    return errno;
+      pthread_attr_destroy (attr);
+      return err;
+    }
 
   attr->__inheritsched = descr->p_inheritsched;
   attr->__scope = PTHREAD_SCOPE_SYSTEM;
@@ -306,3 +331,96 @@ int pthread_getattr_np (pthread_t thread, pthread_attr_t *attr)
 
   return 0;
 }
+
+int pthread_attr_setaffinity_np (pthread_attr_t *attr, size_t cpusetsize,
+				 const cpu_set_t *cpuset)
+{
+  void *copy;
+
+  if (cpuset == NULL || cpusetsize == 0)
+    {
+      free (attr->__cpuset);
+      attr->__cpuset = NULL;
+      attr->__cpusetsize = 0;
+      return 0;
+    }
+  if (cpusetsize != attr->__cpusetsize)
+    {
+      copy = realloc (attr->__cpuset, cpusetsize);
+      if (copy == NULL)
+	return ENOMEM;
+      attr->__cpuset = copy;
+      attr->__cpusetsize = cpusetsize;
+    }
+  memcpy (attr->__cpuset, cpuset, cpusetsize);
+  return 0;
+}
+
+int pthread_attr_getaffinity_np (const pthread_attr_t *attr, size_t cpusetsize,
+				 cpu_set_t *cpuset)
+{
+  if (attr->__cpuset == NULL)
+    {
+      /* No affinity was requested: the thread may run anywhere.  */
+      memset (cpuset, 0xff, cpusetsize);
+      return 0;
+    }
+  if (cpusetsize < attr->__cpusetsize)
+    {
+      /* The caller's set is too small if it misses any requested CPU.  */
+      const unsigned char *p = attr->__cpuset;
+      size_t i;
+
+      for (i = cpusetsize; i < attr->__cpusetsize; i++)
+	if (p[i] != 0)
+	  return EINVAL;
+      memcpy (cpuset, attr->__cpuset, cpusetsize);
+    }
+  else
+    {
+      memcpy (cpuset, attr->__cpuset, attr->__cpusetsize);
+      memset ((char *) cpuset + attr->__cpusetsize, 0,
+	      cpusetsize - attr->__cpusetsize);
+    }
+  return 0;
+}
+
+int pthread_setaffinity_np (pthread_t thread, size_t cpusetsize,
+			    const cpu_set_t *cpuset)
+{
+  pthread_handle handle = thread_handle (thread);
+  pid_t pid;
+
+  __pthread_lock (&handle->h_lock, NULL);
+  if (nonexisting_handle (handle, thread))
+    {
+      __pthread_unlock (&handle->h_lock);
+      return ESRCH;
+    }
+  pid = handle->h_descr->p_pid;
+  __pthread_unlock (&handle->h_lock);
+
+  if (__sched_setaffinity (pid, cpusetsize, cpuset) != 0)
+    return errno;
+  return 0;
+}
+
+int pthread_getaffinity_np (pthread_t thread, size_t cpusetsize,
+			    cpu_set_t *cpuset)
+{
+  pthread_handle handle = thread_handle (thread);
+  pid_t pid;
+
+  __pthread_lock (&handle->h_lock, NULL);
+  if (nonexisting_handle (handle, thread))
+    {
+      __pthread_unlock (&handle->h_lock);
+      return ESRCH;
+    }
+  pid = handle->h_descr->p_pid;
+  __pthread_unlock (&handle->h_lock);
+
+  if (__sched_getaffinity (pid, cpusetsize, cpuset) != 0)
+    return errno;
+  return 0;
+}
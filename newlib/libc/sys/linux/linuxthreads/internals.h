@@ -76,6 +76,12 @@ struct pthread_start_args {
   ((PTHREAD_KEYS_MAX + PTHREAD_KEY_2NDLEVEL_SIZE - 1) \
    / PTHREAD_KEY_2NDLEVEL_SIZE)
 
+/* The values of the first keys are stored in the thread descriptor
+   itself, so that accessing them needs neither the second-level array
+   nor its allocation.  This covers exactly the first second-level
+   array, so p_specific[0] is never used.  */
+#define PTHREAD_KEY_INLINE_SIZE	PTHREAD_KEY_2NDLEVEL_SIZE
+
 typedef void (*destr_function)(void *);
 
 struct pthread_key_struct {
@@ -164,6 +170,7 @@ struct _pthread_descr_struct {
   char p_sigwaiting;            /* true if a sigwait() is in progress */
   struct pthread_start_args p_start_args; /* arguments for thread creation */
   void ** p_specific[PTHREAD_KEY_1STLEVEL_SIZE]; /* thread-specific data */
+  void * p_specific_inline[PTHREAD_KEY_INLINE_SIZE]; /* data of first keys */
   void * p_libc_specific[_LIBC_TSD_KEY_N]; /* thread-specific data for libc */
   int p_userstack;		/* nonzero if the user provided the stack */
   void *p_guardaddr;		/* address of guard area or NULL */
@@ -243,6 +250,10 @@ extern int __pthread_sig_cancel;
 
 extern int __pthread_sig_debug;
 
+/* Signal received by the thread owning the kernel timers */
+
+extern int __pthread_sig_timer;
+
 /* Global array of thread handles, used for validating a thread id
    and retrieving the corresponding thread descriptor. Also used for
    mapping the available stack segments. */
@@ -530,6 +541,11 @@ extern int __pthread_spin_unlock (pthread_spinlock_t *__lock);
 extern int __pthread_spin_init (pthread_spinlock_t *__lock, int __pshared);
 extern int __pthread_spin_destroy (pthread_spinlock_t *__lock);
 
+extern int __sched_setaffinity (pid_t __pid, size_t __cpusetsize,
+			       const cpu_set_t *__cpuset);
+extern int __sched_getaffinity (pid_t __pid, size_t __cpusetsize,
+			       cpu_set_t *__cpuset);
+
 extern int __pthread_clock_gettime (hp_timing_t freq, struct timespec *tp);
 extern void __pthread_clock_settime (hp_timing_t offset);
 
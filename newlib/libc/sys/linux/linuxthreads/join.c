@@ -15,6 +15,7 @@
 /* Thread termination and joining */
 
 #include <errno.h>
+#include <reent.h>
 #include <sched.h>
 #include <stdlib.h>
 #include <unistd.h>
@@ -40,6 +41,14 @@ void __pthread_do_exit(void *retval, char *currentframe)
   /* Call cleanup functions and destroy the thread-specific data */
   __pthread_perform_cleanup(currentframe);
   __pthread_destroy_specifics();
+#if defined(_REENT_SMALL) || defined(_REENT_GLOBAL_STDIO_STREAMS)
+  /* Free what our struct _reent allocated on demand.  The standard
+     streams are shared with the other threads, so this does not close
+     them.  The manager reinitializes the structure when the descriptor
+     is reused.  */
+  if (self != __pthread_main_thread)
+    _reclaim_reent(THREAD_GETMEM(self, p_reentp));
+#endif
   /* Store return value */
   __pthread_lock(THREAD_GETMEM(self, p_lock), self);
   THREAD_SETMEM(self, p_retval, retval);
@@ -719,6 +719,10 @@ static int pthread_handle_create(pthread_t *thread, const pthread_attr_t *attr,
   /* Set pid field of the new thread, in case we get there before the
      child starts. */
   new_thread->p_pid = pid;
+  /* Apply the requested affinity while the creator still waits for
+     us, so the thread is pinned by the time pthread_create returns.  */
+  if (attr != NULL && attr->__cpuset != NULL)
+    __sched_setaffinity (pid, attr->__cpusetsize, attr->__cpuset);
   return 0;
 }
 
@@ -66,6 +66,13 @@ struct timer_node
   struct thread_node *thread;
   pid_t creator_pid;
   int refcount;
+  /* Kernel timer implementing this timer, or -1 if the timer is
+     emulated by a timer thread.  */
+  int ktimerid;
+  /* Generation of the kernel timer, which its signals carry along with
+     the timer id, so that a signal queued for a deleted timer is not
+     taken for one of a new timer in the same slot.  */
+  unsigned int kgen;
 };
 
 
@@ -201,6 +208,7 @@ list_unlink_ip (struct list_links *list)
 extern void __timer_mutex_cancel_handler (void *arg);
 extern void __timer_init_once (void);
 extern struct timer_node *__timer_alloc (void);
+extern int __timer_attr_copy (pthread_attr_t *dst, const pthread_attr_t *src);
 extern int __timer_thread_start (struct thread_node *thread);
 extern struct thread_node *__timer_thread_find_matching (const pthread_attr_t *desired_attr, clockid_t);
 extern struct thread_node *__timer_thread_alloc (const pthread_attr_t *desired_attr, clockid_t);
@@ -208,3 +216,18 @@ extern void __timer_thread_dealloc (struct thread_node *thread);
 extern int __timer_thread_queue_timer (struct thread_node *thread,
 				       struct timer_node *insert);
 extern void __timer_thread_wakeup (struct thread_node *thread);
+
+/* Kernel timers, see timer_routines.c.  */
+enum
+{
+  TIMER_OP_CREATE,
+  TIMER_OP_SETTIME,
+  TIMER_OP_GETTIME,
+  TIMER_OP_GETOVERRUN,
+  TIMER_OP_DELETE
+};
+
+extern int __timer_kernel_create (struct timer_node *timer);
+extern int __timer_kernel_call (int op, int ktimerid, int flags,
+				const struct itimerspec *value,
+				struct itimerspec *ovalue);
@@ -124,6 +124,7 @@ struct _pthread_descr_struct __pthread_initial_thread = {
   PTHREAD_START_ARGS_INITIALIZER(NULL),
                               /* struct pthread_start_args p_start_args */
   {NULL},                     /* void ** p_specific[PTHREAD_KEY_1STLEVEL_SIZE] */
+  {NULL},                     /* void * p_specific_inline[PTHREAD_KEY_INLINE_SIZE] */
   {NULL},                     /* void * p_libc_specific[_LIBC_TSD_KEY_N] */
   1,                          /* int p_userstack */
   NULL,                       /* void * p_guardaddr */
@@ -181,6 +182,7 @@ struct _pthread_descr_struct __pthread_manager_thread = {
   PTHREAD_START_ARGS_INITIALIZER(__pthread_manager),
                               /* struct pthread_start_args p_start_args */
   {NULL},                     /* void ** p_specific[PTHREAD_KEY_1STLEVEL_SIZE] */
+  {NULL},                     /* void * p_specific_inline[PTHREAD_KEY_INLINE_SIZE] */
   {NULL},                     /* void * p_libc_specific[_LIBC_TSD_KEY_N] */
   0,                          /* int p_userstack */
   NULL,                       /* void * p_guardaddr */
@@ -281,10 +283,18 @@ static int current_rtmax = -1;
 int __pthread_sig_restart = SIGUSR1;
 int __pthread_sig_cancel = SIGUSR2;
 int __pthread_sig_debug;
+int __pthread_sig_timer;
 #else
 static int current_rtmin;
 static int current_rtmax;
 
+/* Signal used by the kernel timer thread, see timer_routines.c.  */
+#if __SIGRTMAX - __SIGRTMIN >= 4
+int __pthread_sig_timer = __SIGRTMIN + 3;
+#else
+int __pthread_sig_timer;
+#endif
+
 #if __SIGRTMAX - __SIGRTMIN >= 3
 int __pthread_sig_restart = __SIGRTMIN;
 int __pthread_sig_cancel = __SIGRTMIN + 1;
@@ -314,12 +324,17 @@ init_rtsigs (void)
       __pthread_sig_cancel = SIGUSR2;
       __pthread_sig_debug = 0;
 # endif
+      __pthread_sig_timer = 0;
     }
   else
 #endif	/* __ASSUME_REALTIME_SIGNALS */
     {
 #if __SIGRTMAX - __SIGRTMIN >= 3
+# if __SIGRTMAX - __SIGRTMIN >= 4
+      current_rtmin = __SIGRTMIN + 4;
+# else
       current_rtmin = __SIGRTMIN + 3;
+# endif
 # if !__ASSUME_REALTIME_SIGNALS
       __pthread_restart = __pthread_restart_new;
       __pthread_suspend = __pthread_wait_for_restart_signal;
@@ -725,6 +740,8 @@ int __pthread_create_2_0(pthread_t *thread, const pthread_attr_t *attr,
       new_attr.__stackaddr_set = 0;
       new_attr.__stackaddr = NULL;
       new_attr.__stacksize = STACK_SIZE - ps;
+      new_attr.__cpusetsize = 0;
+      new_attr.__cpuset = NULL;
       attr = &new_attr;
     }
   return __pthread_create_2_1 (thread, attr, start_routine, arg);
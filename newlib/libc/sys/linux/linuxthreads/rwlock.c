@@ -23,6 +23,8 @@
 #include <errno.h>
 #include <pthread.h>
 #include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
 #include "internals.h"
 #include "queue.h"
 #include "spinlock.h"
@@ -211,6 +213,329 @@ rwlock_have_already(pthread_descr *pself, pthread_rwlock_t *rwlock,
   return have_lock_already;
 }
 
+/*
+ * Scalable read-write locks (PTHREAD_RWLOCK_SCALABLE_NP).
+ *
+ * Readers announce themselves in one of RW_STRIPES counters, each on its
+ * own cache line, chosen by the thread's handle index, and then check the
+ * writer state.  While no writer is around, taking and releasing a read
+ * lock touches only the reader's own stripe and never the internal lock.
+ *
+ * A writer first becomes the owner (__rw_writer) under the internal lock,
+ * which sets __rw_wrstate and turns new readers away, and then waits for
+ * the sum of the stripes to drop to zero.  Readers that find a writer
+ * wait in __rw_read_waiting.  When the writer unlocks it admits all of
+ * them at once, by counting them in their stripes, before handing the
+ * lock to the next waiting writer.  So writers are preferred but readers
+ * are never starved.  Read locks are not recursive, as with
+ * PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP.
+ */
+
+#define RW_STRIPES 16
+#define RW_STRIPE_ALIGN 64
+
+/* Values of __rw_wrstate.  */
+#define RW_NO_WRITER 0
+#define RW_WRITER 1		/* Owned by __rw_writer, or handed to it.  */
+#define RW_WRITER_SLEEPING 2	/* __rw_writer waits for readers to drain.  */
+
+struct rwlock_stripe
+{
+  long count;
+  int lock;			/* Only used without compare-and-swap.  */
+  char pad[RW_STRIPE_ALIGN - sizeof (long) - sizeof (int)];
+};
+
+#define RW_STATE(rwlock) (*(volatile long *) &(rwlock)->__rw_wrstate)
+
+static struct rwlock_stripe *
+rwlock_stripe(pthread_rwlock_t *rwlock, pthread_descr th)
+{
+  struct rwlock_stripe *stripes = rwlock->__rw_stripes;
+
+  return &stripes[th->p_nr & (RW_STRIPES - 1)];
+}
+
+static void
+stripe_add(struct rwlock_stripe *stripe, long delta)
+{
+  long old;
+
+  do
+    old = stripe->count;
+  while (!compare_and_swap (&stripe->count, old, old + delta, &stripe->lock));
+  MEMORY_BARRIER ();
+}
+
+/* Store a new writer state with a full barrier, so that the reader
+   counts read afterwards include every reader that missed it.  */
+
+static void
+rwlock_set_wrstate(pthread_rwlock_t *rwlock, long state)
+{
+  struct rwlock_stripe *stripes = rwlock->__rw_stripes;
+  long old;
+
+  do
+    old = rwlock->__rw_wrstate;
+  while (!compare_and_swap (&rwlock->__rw_wrstate, old, state,
+			    &stripes[0].lock));
+  MEMORY_BARRIER ();
+}
+
+static long
+rwlock_readers(pthread_rwlock_t *rwlock)
+{
+  struct rwlock_stripe *stripes = rwlock->__rw_stripes;
+  long sum = 0;
+  int i;
+
+  for (i = 0; i < RW_STRIPES; i++)
+    sum += ((volatile struct rwlock_stripe *) stripes)[i].count;
+  return sum;
+}
+
+/* Drop a reader count and wake the writer if it was the last one it
+   waits for.  */
+
+static void
+scalable_rdrelease(pthread_rwlock_t *rwlock, pthread_descr self)
+{
+  pthread_descr th = NULL;
+
+  stripe_add (rwlock_stripe (rwlock, self), -1);
+  if (RW_STATE (rwlock) != RW_WRITER_SLEEPING)
+    return;
+
+  __pthread_lock (&rwlock->__rw_lock, self);
+  if (rwlock->__rw_wrstate == RW_WRITER_SLEEPING
+      && rwlock_readers (rwlock) == 0)
+    {
+      rwlock->__rw_wrstate = RW_WRITER;
+      th = rwlock->__rw_writer;
+    }
+  __pthread_unlock (&rwlock->__rw_lock);
+  if (th != NULL)
+    restart (th);
+}
+
+/* Try to take a read lock without the internal lock.  */
+
+static int
+scalable_rdlock_fast(pthread_rwlock_t *rwlock, pthread_descr self)
+{
+  stripe_add (rwlock_stripe (rwlock, self), 1);
+  if (RW_STATE (rwlock) == RW_NO_WRITER)
+    return 1;
+  scalable_rdrelease (rwlock, self);
+  return 0;
+}
+
+/* Give up write ownership: admit all waiting readers and pass the lock
+   on to the next waiting writer, if any.  The internal lock must be
+   held and is released.  */
+
+static void
+scalable_wrrelease(pthread_rwlock_t *rwlock)
+{
+  pthread_descr readers, writer, th;
+
+  readers = rwlock->__rw_read_waiting;
+  rwlock->__rw_read_waiting = NULL;
+  for (th = readers; th != NULL; th = th->p_nextwaiting)
+    stripe_add (rwlock_stripe (rwlock, th), 1);
+
+  writer = dequeue (&rwlock->__rw_write_waiting);
+  rwlock->__rw_writer = writer;
+  rwlock->__rw_wrstate = writer != NULL ? RW_WRITER : RW_NO_WRITER;
+  __pthread_unlock (&rwlock->__rw_lock);
+
+  while ((th = dequeue (&readers)) != NULL)
+    restart (th);
+  if (writer != NULL)
+    restart (writer);
+}
+
+/* Wait until the readers that got in before this thread became the
+   owner are gone.  On timeout, ownership is given up again.  */
+
+static int
+scalable_wrdrain(pthread_rwlock_t *rwlock, pthread_descr self,
+		 const struct timespec *abstime)
+{
+  for (;;)
+    {
+      __pthread_lock (&rwlock->__rw_lock, self);
+      rwlock_set_wrstate (rwlock, RW_WRITER_SLEEPING);
+      if (rwlock_readers (rwlock) == 0)
+	{
+	  rwlock->__rw_wrstate = RW_WRITER;
+	  __pthread_unlock (&rwlock->__rw_lock);
+	  return 0;
+	}
+      __pthread_unlock (&rwlock->__rw_lock);
+
+      if (abstime == NULL)
+	suspend (self); /* This is not a cancellation point */
+      else if (timedsuspend (self, abstime) == 0)
+	{
+	  __pthread_lock (&rwlock->__rw_lock, self);
+	  if (rwlock->__rw_wrstate == RW_WRITER_SLEEPING)
+	    {
+	      scalable_wrrelease (rwlock);
+	      return ETIMEDOUT;
+	    }
+	  __pthread_unlock (&rwlock->__rw_lock);
+
+	  /* Eat the outstanding restart() from the last reader */
+	  suspend (self);
+	}
+    }
+}
+
+/* Sleep on QUEUE until another thread restarts us.  The internal lock
+   must be held and is released.  Returns 0 once restarted, or
+   ETIMEDOUT if we were still queued when the timeout expired.  */
+
+static int
+scalable_wait(pthread_rwlock_t *rwlock, pthread_descr self,
+	      pthread_descr *queue, int (*extricate)(void *, pthread_descr),
+	      const struct timespec *abstime)
+{
+  pthread_extricate_if extr;
+  int was_on_queue;
+
+  if (abstime == NULL)
+    {
+      enqueue (queue, self);
+      __pthread_unlock (&rwlock->__rw_lock);
+      suspend (self); /* This is not a cancellation point */
+      return 0;
+    }
+
+  extr.pu_object = rwlock;
+  extr.pu_extricate_func = extricate;
+  __pthread_set_own_extricate_if (self, &extr);
+
+  enqueue (queue, self);
+  __pthread_unlock (&rwlock->__rw_lock);
+  if (timedsuspend (self, abstime) == 0)
+    {
+      __pthread_lock (&rwlock->__rw_lock, self);
+      was_on_queue = remove_from_queue (queue, self);
+      __pthread_unlock (&rwlock->__rw_lock);
+
+      if (was_on_queue)
+	{
+	  __pthread_set_own_extricate_if (self, 0);
+	  return ETIMEDOUT;
+	}
+
+      /* Eat the outstanding restart() from the signaller */
+      suspend (self);
+    }
+
+  __pthread_set_own_extricate_if (self, 0);
+  return 0;
+}
+
+static int
+scalable_rdlock(pthread_rwlock_t *rwlock, const struct timespec *abstime)
+{
+  pthread_descr self = thread_self ();
+
+  if (scalable_rdlock_fast (rwlock, self))
+    return 0;
+
+  __pthread_lock (&rwlock->__rw_lock, self);
+  if (rwlock->__rw_writer == NULL)
+    {
+      stripe_add (rwlock_stripe (rwlock, self), 1);
+      __pthread_unlock (&rwlock->__rw_lock);
+      return 0;
+    }
+  if (rwlock->__rw_writer == self)
+    {
+      __pthread_unlock (&rwlock->__rw_lock);
+      return EDEADLK;
+    }
+
+  /* The writer that unlocks next counts us as a reader before it
+     restarts us.  */
+  return scalable_wait (rwlock, self, &rwlock->__rw_read_waiting,
+			rwlock_rd_extricate_func, abstime);
+}
+
+static int
+scalable_wrlock(pthread_rwlock_t *rwlock, const struct timespec *abstime)
+{
+  pthread_descr self = thread_self ();
+  int err;
+
+  __pthread_lock (&rwlock->__rw_lock, self);
+  if (rwlock->__rw_writer == self)
+    {
+      __pthread_unlock (&rwlock->__rw_lock);
+      return EDEADLK;
+    }
+  if (rwlock->__rw_writer == NULL)
+    {
+      rwlock->__rw_writer = self;
+      rwlock->__rw_wrstate = RW_WRITER;
+      __pthread_unlock (&rwlock->__rw_lock);
+    }
+  else
+    {
+      /* The current owner hands the lock to us when it unlocks.  */
+      err = scalable_wait (rwlock, self, &rwlock->__rw_write_waiting,
+			   rwlock_wr_extricate_func, abstime);
+      if (err != 0)
+	return err;
+    }
+
+  return scalable_wrdrain (rwlock, self, abstime);
+}
+
+static int
+scalable_trywrlock(pthread_rwlock_t *rwlock)
+{
+  pthread_descr self = thread_self ();
+
+  __pthread_lock (&rwlock->__rw_lock, self);
+  if (rwlock->__rw_writer != NULL || rwlock_readers (rwlock) != 0)
+    {
+      __pthread_unlock (&rwlock->__rw_lock);
+      return EBUSY;
+    }
+  rwlock->__rw_writer = self;
+  rwlock_set_wrstate (rwlock, RW_WRITER);
+
+  /* A reader may have slipped in before it could see us.  */
+  if (rwlock_readers (rwlock) != 0)
+    {
+      scalable_wrrelease (rwlock);
+      return EBUSY;
+    }
+  __pthread_unlock (&rwlock->__rw_lock);
+  return 0;
+}
+
+static int
+scalable_unlock(pthread_rwlock_t *rwlock)
+{
+  pthread_descr self = thread_self ();
+
+  if (rwlock->__rw_writer == self)
+    {
+      __pthread_lock (&rwlock->__rw_lock, self);
+      scalable_wrrelease (rwlock);
+    }
+  else
+    scalable_rdrelease (rwlock, self);
+
+  return 0;
+}
+
 int
 __pthread_rwlock_init (pthread_rwlock_t *rwlock,
 		       const pthread_rwlockattr_t *attr)
@@ -220,6 +545,8 @@ __pthread_rwlock_init (pthread_rwlock_t *rwlock,
   rwlock->__rw_writer = NULL;
   rwlock->__rw_read_waiting = NULL;
   rwlock->__rw_write_waiting = NULL;
+  rwlock->__rw_stripes = NULL;
+  rwlock->__rw_wrstate = RW_NO_WRITER;
 
   if (attr == NULL)
     {
@@ -232,6 +559,19 @@ __pthread_rwlock_init (pthread_rwlock_t *rwlock,
       rwlock->__rw_pshared = attr->__pshared;
     }
 
+  if (rwlock->__rw_kind == PTHREAD_RWLOCK_SCALABLE_NP)
+    {
+      rwlock->__rw_stripes = memalign (RW_STRIPE_ALIGN,
+				       RW_STRIPES
+				       * sizeof (struct rwlock_stripe));
+      if (rwlock->__rw_stripes != NULL)
+	memset (rwlock->__rw_stripes, 0,
+		RW_STRIPES * sizeof (struct rwlock_stripe));
+      else
+	/* Same semantics, but with a single reader count.  */
+	rwlock->__rw_kind = PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP;
+    }
+
   return 0;
 }
 strong_alias (__pthread_rwlock_init, pthread_rwlock_init)
@@ -245,12 +585,16 @@ __pthread_rwlock_destroy (pthread_rwlock_t *rwlock)
 
   __pthread_lock (&rwlock->__rw_lock, NULL);
   readers = rwlock->__rw_readers;
+  if (rwlock->__rw_stripes != NULL)
+    readers += rwlock_readers (rwlock);
   writer = rwlock->__rw_writer;
   __pthread_unlock (&rwlock->__rw_lock);
 
   if (readers > 0 || writer != NULL)
     return EBUSY;
 
+  free (rwlock->__rw_stripes);
+  rwlock->__rw_stripes = NULL;
   return 0;
 }
 strong_alias (__pthread_rwlock_destroy, pthread_rwlock_destroy)
@@ -262,6 +606,9 @@ __pthread_rwlock_rdlock (pthread_rwlock_t *rwlock)
   pthread_readlock_info *existing;
   int out_of_mem, have_lock_already;
 
+  if (rwlock->__rw_stripes != NULL)
+    return scalable_rdlock (rwlock, NULL);
+
   have_lock_already = rwlock_have_already(&self, rwlock,
 					  &existing, &out_of_mem);
 
@@ -307,6 +654,9 @@ __pthread_rwlock_timedrdlock (pthread_rwlock_t *rwlock,
   if (abstime->tv_nsec < 0 || abstime->tv_nsec >= 1000000000)
     return EINVAL;
 
+  if (rwlock->__rw_stripes != NULL)
+    return scalable_rdlock (rwlock, abstime);
+
   have_lock_already = rwlock_have_already(&self, rwlock,
 					  &existing, &out_of_mem);
 
@@ -374,6 +724,9 @@ __pthread_rwlock_tryrdlock (pthread_rwlock_t *rwlock)
   int out_of_mem, have_lock_already;
   int retval = EBUSY;
 
+  if (rwlock->__rw_stripes != NULL)
+    return scalable_rdlock_fast (rwlock, self) ? 0 : EBUSY;
+
   have_lock_already = rwlock_have_already(&self, rwlock,
       &existing, &out_of_mem);
 
@@ -412,8 +765,12 @@ strong_alias (__pthread_rwlock_tryrdlock, pthread_rwlock_tryrdlock)
 int
 __pthread_rwlock_wrlock (pthread_rwlock_t *rwlock)
 {
-  pthread_descr self = thread_self ();
+  pthread_descr self;
 
+  if (rwlock->__rw_stripes != NULL)
+    return scalable_wrlock (rwlock, NULL);
+
+  self = thread_self ();
   while(1)
     {
       __pthread_lock (&rwlock->__rw_lock, self);
@@ -443,6 +800,9 @@ __pthread_rwlock_timedwrlock (pthread_rwlock_t *rwlock,
   if (abstime->tv_nsec < 0 || abstime->tv_nsec >= 1000000000)
     return EINVAL;
 
+  if (rwlock->__rw_stripes != NULL)
+    return scalable_wrlock (rwlock, abstime);
+
   self = thread_self ();
 
   /* Set up extrication interface */
@@ -495,6 +855,9 @@ __pthread_rwlock_trywrlock (pthread_rwlock_t *rwlock)
 {
   int result = EBUSY;
 
+  if (rwlock->__rw_stripes != NULL)
+    return scalable_trywrlock (rwlock);
+
   __pthread_lock (&rwlock->__rw_lock, NULL);
   if (rwlock->__rw_readers == 0 && rwlock->__rw_writer == NULL)
     {
@@ -514,6 +877,9 @@ __pthread_rwlock_unlock (pthread_rwlock_t *rwlock)
   pthread_descr torestart;
   pthread_descr th;
 
+  if (rwlock->__rw_stripes != NULL)
+    return scalable_unlock (rwlock);
+
   __pthread_lock (&rwlock->__rw_lock, NULL);
   if (rwlock->__rw_writer != NULL)
     {
@@ -649,6 +1015,7 @@ pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *attr, int pref)
   if (pref != PTHREAD_RWLOCK_PREFER_READER_NP
       && pref != PTHREAD_RWLOCK_PREFER_WRITER_NP
       && pref != PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP
+      && pref != PTHREAD_RWLOCK_SCALABLE_NP
       && pref != PTHREAD_RWLOCK_DEFAULT_NP)
     return EINVAL;
 
@@ -81,7 +81,9 @@ static void pthread_key_delete_helper(void *arg, pthread_descr th)
   if (!th->p_terminated) {
     /* pthread_exit() may try to free th->p_specific[idx1st] concurrently. */
     __pthread_lock(THREAD_GETMEM(th, p_lock), self);
-    if (th->p_specific[idx1st] != NULL)
+    if (idx1st == 0)
+      th->p_specific_inline[idx2nd] = NULL;
+    else if (th->p_specific[idx1st] != NULL)
       th->p_specific[idx1st][idx2nd] = NULL;
     __pthread_unlock(THREAD_GETMEM(th, p_lock));
   }
@@ -138,6 +140,10 @@ int __pthread_setspecific(pthread_key_t key, const void * pointer)
 
   if (key >= PTHREAD_KEYS_MAX || !pthread_keys[key].in_use)
     return EINVAL;
+  if (key < PTHREAD_KEY_INLINE_SIZE) {
+    THREAD_SETMEM_NC(self, p_specific_inline[key], (void *) pointer);
+    return 0;
+  }
   idx1st = key / PTHREAD_KEY_2NDLEVEL_SIZE;
   idx2nd = key % PTHREAD_KEY_2NDLEVEL_SIZE;
   if (THREAD_GETMEM_NC(self, p_specific[idx1st]) == NULL) {
@@ -158,6 +164,11 @@ void * __pthread_getspecific(pthread_key_t key)
   pthread_descr self = thread_self();
   unsigned int idx1st, idx2nd;
 
+  /* No in_use check is needed here: the value of a key that is not in
+     use is NULL in every thread, since pthread_key_delete clears it and
+     pthread_setspecific refuses to set it.  */
+  if (key < PTHREAD_KEY_INLINE_SIZE)
+    return THREAD_GETMEM_NC(self, p_specific_inline[key]);
   if (key >= PTHREAD_KEYS_MAX)
     return NULL;
   idx1st = key / PTHREAD_KEY_2NDLEVEL_SIZE;
@@ -182,7 +193,16 @@ void __pthread_destroy_specifics()
        found_nonzero && round < PTHREAD_DESTRUCTOR_ITERATIONS;
        round++) {
     found_nonzero = 0;
-    for (i = 0; i < PTHREAD_KEY_1STLEVEL_SIZE; i++)
+    for (j = 0; j < PTHREAD_KEY_INLINE_SIZE; j++) {
+      destr = pthread_keys[j].destr;
+      data = THREAD_GETMEM_NC(self, p_specific_inline[j]);
+      if (destr != NULL && data != NULL) {
+        THREAD_SETMEM_NC(self, p_specific_inline[j], NULL);
+        destr(data);
+        found_nonzero = 1;
+      }
+    }
+    for (i = 1; i < PTHREAD_KEY_1STLEVEL_SIZE; i++)
       if (THREAD_GETMEM_NC(self, p_specific[i]) != NULL)
         for (j = 0; j < PTHREAD_KEY_2NDLEVEL_SIZE; j++) {
           destr = pthread_keys[i * PTHREAD_KEY_2NDLEVEL_SIZE + j].destr;
@@ -195,7 +215,9 @@ void __pthread_destroy_specifics()
         }
   }
   __pthread_lock(THREAD_GETMEM(self, p_lock), self);
-  for (i = 0; i < PTHREAD_KEY_1STLEVEL_SIZE; i++) {
+  for (j = 0; j < PTHREAD_KEY_INLINE_SIZE; j++)
+    THREAD_SETMEM_NC(self, p_specific_inline[j], NULL);
+  for (i = 1; i < PTHREAD_KEY_1STLEVEL_SIZE; i++) {
     if (THREAD_GETMEM_NC(self, p_specific[i]) != NULL) {
       free(THREAD_GETMEM_NC(self, p_specific[i]));
       THREAD_SETMEM_NC(self, p_specific[i], NULL);
@@ -57,17 +57,23 @@ td_thr_tsd (const td_thrhandle_t *th, const thread_key_t tk, void **data)
   idx1st = tk / pthread_key_2ndlevel_size;
   idx2nd = tk % pthread_key_2ndlevel_size;
 
-  /* Check the pointer to the second level array.  */
-  if (pds.p_specific[idx1st] == NULL)
-    return TD_NOTSD;
-
-  /* Now get the real key.
-     XXX I don't know whether it's correct but there is currently no
-     easy way to determine whether a key was never set or the value
-     is NULL.  We return an error whenever the value is NULL.  */
-  if (ps_pdread (th->th_ta_p->ph, &pds.p_specific[idx1st][idx2nd], &p,
-		 sizeof (void *)) != PS_OK)
-    return TD_ERR;
+  /* The first keys are kept in the descriptor itself.  */
+  if (tk < PTHREAD_KEY_INLINE_SIZE)
+    p = pds.p_specific_inline[tk];
+  else
+    {
+      /* Check the pointer to the second level array.  */
+      if (pds.p_specific[idx1st] == NULL)
+	return TD_NOTSD;
+
+      /* Now get the real key.
+	 XXX I don't know whether it's correct but there is currently no
+	 easy way to determine whether a key was never set or the value
+	 is NULL.  We return an error whenever the value is NULL.  */
+      if (ps_pdread (th->th_ta_p->ph, &pds.p_specific[idx1st][idx2nd], &p,
+		     sizeof (void *)) != PS_OK)
+	return TD_ERR;
+    }
 
   if (p != NULL)
     *data = p;
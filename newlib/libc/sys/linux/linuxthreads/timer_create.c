@@ -79,6 +79,26 @@ timer_create (clock_id, evp, timerid)
 
   newtimer->event.sigev_notify_attributes = &newtimer->attr;
   newtimer->creator_pid = getpid ();
+  newtimer->clock = clock_id;
+
+  /* Prefer a kernel timer.  Only notification threads with specific
+     attributes need a timer thread of their own.  */
+  if (newtimer->event.sigev_notify == SIGEV_NONE
+      || newtimer->event.sigev_notify == SIGEV_SIGNAL
+      || (newtimer->event.sigev_notify == SIGEV_THREAD
+	  && evp->sigev_notify_attributes == NULL))
+    {
+      int saved_errno = errno;
+      int kernel;
+
+      pthread_mutex_unlock (&__timer_mutex);
+      kernel = __timer_kernel_create (newtimer) == 0;
+      pthread_mutex_lock (&__timer_mutex);
+      __set_errno (saved_errno);
+
+      if (kernel)
+	goto setup;
+    }
 
   switch (__builtin_expect (newtimer->event.sigev_notify, SIGEV_SIGNAL))
     {
@@ -119,11 +139,14 @@ timer_create (clock_id, evp, timerid)
       break;
 
     case SIGEV_THREAD:
-      /* Copy over thread attributes or set up default ones.  */
-      if (evp->sigev_notify_attributes)
-	newtimer->attr = *(pthread_attr_t *) evp->sigev_notify_attributes;
-      else
-	pthread_attr_init (&newtimer->attr);
+      /* Copy over thread attributes; __timer_alloc set up default ones.  */
+      if (evp->sigev_notify_attributes
+	  && __timer_attr_copy (&newtimer->attr,
+				evp->sigev_notify_attributes) != 0)
+	{
+	  __set_errno (EAGAIN);
+	  goto unlock_bail;
+	}
 
       /* Ensure thread attributes call for deatched thread.  */
       pthread_attr_setdetachstate (&newtimer->attr, PTHREAD_CREATE_DETACHED);
@@ -156,7 +179,7 @@ timer_create (clock_id, evp, timerid)
       goto unlock_bail;
     }
 
-  newtimer->clock = clock_id;
+setup:
   newtimer->abstime = 0;
   newtimer->armed = 0;
   newtimer->thread = thread;
@@ -39,6 +39,19 @@ timer_delete (timerid)
   if (! timer_valid (timer))
     /* Invalid timer ID or the timer is not in use.  */
     __set_errno (EINVAL);
+  else if (timer->ktimerid >= 0)
+    {
+      int ktimerid = timer->ktimerid;
+
+      /* A notification thread already started for the timer may still
+	 be running when the kernel timer is gone.  */
+      timer->inuse = TIMER_DELETED;
+      pthread_mutex_unlock (&__timer_mutex);
+      (void) __timer_kernel_call (TIMER_OP_DELETE, ktimerid, 0, NULL, NULL);
+      pthread_mutex_lock (&__timer_mutex);
+      timer_delref (timer);
+      retval = 0;
+    }
   else
     {
       if (timer->armed && timer->thread != NULL)
@@ -30,16 +30,22 @@ timer_getoverrun (timerid)
      timer_t timerid;
 {
   struct timer_node *timer;
-  int retval = -1;
+  int retval = -1, ktimerid = -1;
 
   pthread_mutex_lock (&__timer_mutex);
 
   if (! timer_valid (timer = timer_id2ptr (timerid)))
     __set_errno (EINVAL);
+  else if (timer->ktimerid >= 0)
+    ktimerid = timer->ktimerid;
   else
     retval = 0; /* TODO: overrun counting not supported */
 
   pthread_mutex_unlock (&__timer_mutex);
 
+  if (ktimerid >= 0)
+    retval = __timer_kernel_call (TIMER_OP_GETOVERRUN, ktimerid, 0, NULL,
+				  NULL);
+
   return retval;
 }
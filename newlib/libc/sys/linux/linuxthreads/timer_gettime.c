@@ -32,7 +32,7 @@ timer_gettime (timerid, value)
 {
   struct timer_node *timer;
   struct timespec now, expiry;
-  int retval = -1, armed = 0, valid;
+  int retval = -1, armed = 0, valid, ktimerid = -1;
   clock_t clock = 0;
 
   pthread_mutex_lock (&__timer_mutex);
@@ -41,6 +41,7 @@ timer_gettime (timerid, value)
   valid = timer_valid (timer);
 
   if (valid) {
+    ktimerid = timer->ktimerid;
     armed = timer->armed;
     expiry = timer->expirytime;
     clock = timer->clock;
@@ -49,6 +50,9 @@ timer_gettime (timerid, value)
 
   pthread_mutex_unlock (&__timer_mutex);
 
+  if (ktimerid >= 0)
+    return __timer_kernel_call (TIMER_OP_GETTIME, ktimerid, 0, NULL, value);
+
   if (valid)
     {
       if (armed)
@@ -20,6 +20,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <pthread.h>
 #include <stddef.h>
 #include <stdlib.h>
@@ -29,6 +30,7 @@
 #include <unistd.h>
 #include <sys/syscall.h>
 
+#include "internals.h"
 #include "posix-timer.h"
 
 
@@ -147,12 +149,37 @@ timer_links2ptr (struct list_links *list)
 }
 
 
-/* Initialize a newly allocated thread structure.  */
-static void
+/* Copy thread attributes.  DST gets its own copy of the CPU set, so
+   that SRC may be destroyed while DST is still in use.  Returns zero,
+   or ENOMEM if the CPU set cannot be copied.  */
+int
+__timer_attr_copy (pthread_attr_t *dst, const pthread_attr_t *src)
+{
+  *dst = *src;
+  if (src->__cpuset != NULL)
+    {
+      dst->__cpuset = malloc (src->__cpusetsize);
+      if (dst->__cpuset == NULL)
+	{
+	  dst->__cpusetsize = 0;
+	  return ENOMEM;
+	}
+      memcpy (dst->__cpuset, src->__cpuset, src->__cpusetsize);
+    }
+  return 0;
+}
+
+
+/* Initialize a newly allocated thread structure.  Returns zero on
+   success.  */
+static int
 thread_init (struct thread_node *thread, const pthread_attr_t *attr, clockid_t clock_id)
 {
   if (attr != NULL)
-    thread->attr = *attr;
+    {
+      if (__timer_attr_copy (&thread->attr, attr) != 0)
+	return -1;
+    }
   else
     {
       pthread_attr_init (&thread->attr);
@@ -165,6 +192,7 @@ thread_init (struct thread_node *thread, const pthread_attr_t *attr, clockid_t c
   thread->current_timer = 0;
   thread->captured = pthread_self ();
   thread->clock_id = clock_id;
+  return 0;
 }
 
 
@@ -184,6 +212,7 @@ init_module (void)
     {
       list_append (&timer_free_list, &__timer_array[i].links);
       __timer_array[i].inuse = TIMER_FREE;
+      __timer_array[i].ktimerid = -1;
     }
 
   for (i = 0; i < THREAD_MAXNODES; ++i)
@@ -203,10 +232,13 @@ init_module (void)
    occurs.  It reinitializes the module, resetting all of the data
    structures to their initial state.  The mutex is initialized in
    case it was locked in the parent process.  */
+static void kernel_reinit (void);
+
 static void
 reinit_after_fork (void)
 {
   init_module ();
+  kernel_reinit ();
   pthread_mutex_init (&__timer_mutex, 0);
 }
 
@@ -230,6 +262,7 @@ thread_deinit (struct thread_node *thread)
 {
   assert (list_isempty (&thread->timer_queue));
   pthread_cond_destroy (&thread->cond);
+  pthread_attr_destroy (&thread->attr);
 }
 
 
@@ -244,8 +277,9 @@ __timer_thread_alloc (const pthread_attr_t *desired_attr, clockid_t clock_id)
   if (node != list_null (&thread_free_list))
     {
       struct thread_node *thread = thread_links2ptr (node);
+      if (thread_init (thread, desired_attr, clock_id) != 0)
+	return 0;
       list_unlink (node);
-      thread_init (thread, desired_attr, clock_id);
       list_append (&thread_active_list, node);
       return thread;
     }
@@ -514,7 +548,11 @@ thread_attr_compare (const pthread_attr_t *left, const pthread_attr_t *right)
 	  && (left->__schedparam.sched_priority
 	      == right->__schedparam.sched_priority)
 	  && left->__inheritsched == right->__inheritsched
-	  && left->__scope == right->__scope);
+	  && left->__scope == right->__scope
+	  && left->__cpusetsize == right->__cpusetsize
+	  && (left->__cpusetsize == 0
+	      || memcmp (left->__cpuset, right->__cpuset,
+			 left->__cpusetsize) == 0));
 }
 
 
@@ -557,6 +595,7 @@ __timer_alloc (void)
       list_unlink_ip (node);
       timer->inuse = TIMER_INUSE;
       timer->refcount = 1;
+      pthread_attr_init (&timer->attr);
       return timer;
     }
 
@@ -571,7 +610,9 @@ __timer_dealloc (struct timer_node *timer)
 {
   assert (timer->refcount == 0);
   timer->thread = NULL;	/* Break association between timer and thread.  */
+  pthread_attr_destroy (&timer->attr);
   timer->inuse = TIMER_FREE;
+  timer->ktimerid = -1;
   list_append (&timer_free_list, &timer->links);
 }
 
@@ -582,3 +623,494 @@ __timer_mutex_cancel_handler (void *arg)
 {
   pthread_mutex_unlock (arg);
 }
+
+
+#ifdef __NR_timer_create
+
+/* Kernel timers.
+
+   With LinuxThreads every thread is a process of its own, and only the
+   process which created a kernel timer can arm, read or delete it.
+   All kernel timers are therefore owned by a single helper thread.
+   It performs the timer system calls on behalf of the other threads,
+   receives the expiry signals of all timers on __pthread_sig_timer,
+   forwards SIGEV_SIGNAL notifications to the creator of the timer and
+   queues SIGEV_THREAD notifications for a single notification thread,
+   which it starts when the first one arrives.  The helper never runs
+   user code, so a blocking notification function cannot hold up the
+   other timers or the timer calls of other threads; it only delays the
+   notifications queued behind it.  The kernel keeps
+   the timers in order, so none of the lists above are involved.
+   Timers whose notification threads need specific attributes, and all
+   timers on kernels without timer system calls, are still emulated by
+   the timer threads above.  So are the timers on the CPU-time clocks:
+   the kernel would measure the CPU time of the helper thread, not the
+   one of the thread or process that created the timer.  */
+
+/* The kernel's values of CLOCK_REALTIME and TIMER_ABSTIME, which differ
+   from the ones of this port.  */
+#define KERNEL_CLOCK_REALTIME	0
+#define KERNEL_TIMER_ABSTIME	1
+
+struct kernel_request
+{
+  int op;
+  struct timer_node *timer;
+  int ktimerid;
+  int flags;
+  const struct itimerspec *value;
+  struct itimerspec *ovalue;
+  int result;
+  int error;
+  int done;
+};
+
+/* Nonzero once the kernel has rejected timer_create with ENOSYS.  */
+static int kernel_no_timers;
+
+/* The helper thread, and its process id once it is running.  */
+static pthread_t kernel_thread;
+static volatile pid_t kernel_pid;
+
+/* Serializes the requests to the helper thread.  */
+static pthread_mutex_t kernel_req_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Protects kernel_req and the done flag of the request; the condition
+   signals its completion and the start of the helper thread.  */
+static pthread_mutex_t kernel_done_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t kernel_done_cond = PTHREAD_COND_INITIALIZER;
+static struct kernel_request *kernel_req;
+
+/* The signal value of a kernel timer is ID + TIMER_MAX * GEN, where GEN
+   runs from 1 to KERNEL_GEN_MAX, so that it fits a positive int.  */
+#define KERNEL_GEN_MAX	(INT_MAX / TIMER_MAX - 1)
+
+/* Generation of the last kernel timer created.  Only the helper thread
+   uses it.  */
+static unsigned int kernel_gen;
+
+/* Attributes of the notification thread.  */
+static pthread_attr_t kernel_notify_attr;
+
+/* A queued SIGEV_THREAD notification.  The function and value are
+   copied, since the timer may be deleted before the notification runs.  */
+struct kernel_notify
+{
+  void (*function) (union sigval);
+  union sigval value;
+  int id;
+  unsigned int gen;
+};
+
+/* Ring of notifications waiting for the notification thread.  A timer is
+   queued once at most: if it expires again before its function has run,
+   the notification is not repeated.  kernel_notify_queued holds the
+   generation of the queued timer of each slot, or zero.  All of this,
+   and whether the notification thread is running, is protected by
+   kernel_notify_lock.  */
+static struct kernel_notify kernel_notify_queue[TIMER_MAX];
+static unsigned int kernel_notify_head;
+static unsigned int kernel_notify_count;
+static unsigned int kernel_notify_queued[TIMER_MAX];
+static int kernel_notify_running;
+static pthread_mutex_t kernel_notify_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t kernel_notify_cond = PTHREAD_COND_INITIALIZER;
+
+
+/* Perform the system call of REQ.  Runs in the helper thread.  */
+static void
+kernel_execute (struct kernel_request *req)
+{
+  struct timer_node *timer = req->timer;
+  int result;
+
+  switch (req->op)
+    {
+    case TIMER_OP_CREATE:
+      {
+	struct sigevent sev;
+	int ktimerid;
+
+	if (++kernel_gen > KERNEL_GEN_MAX)
+	  kernel_gen = 1;
+	timer->kgen = kernel_gen;
+
+	memset (&sev, 0, sizeof (sev));
+	sev.sigev_value.sival_int = (timer_ptr2id (timer)
+				     + TIMER_MAX * kernel_gen);
+	sev.sigev_signo = __pthread_sig_timer;
+	sev.sigev_notify = (timer->event.sigev_notify == SIGEV_NONE
+			    ? SIGEV_NONE : SIGEV_SIGNAL);
+	result = INLINE_SYSCALL (timer_create, 3, KERNEL_CLOCK_REALTIME, &sev,
+				 &ktimerid);
+	if (result == 0)
+	  timer->ktimerid = ktimerid;
+      }
+      break;
+
+    case TIMER_OP_SETTIME:
+      result = INLINE_SYSCALL (timer_settime, 4, req->ktimerid,
+			       ((req->flags & TIMER_ABSTIME)
+				? KERNEL_TIMER_ABSTIME : 0),
+			       req->value, req->ovalue);
+      break;
+
+    case TIMER_OP_GETTIME:
+      result = INLINE_SYSCALL (timer_gettime, 2, req->ktimerid,
+			       req->ovalue);
+      break;
+
+    case TIMER_OP_GETOVERRUN:
+      result = INLINE_SYSCALL (timer_getoverrun, 1, req->ktimerid);
+      break;
+
+    case TIMER_OP_DELETE:
+      result = INLINE_SYSCALL (timer_delete, 1, req->ktimerid);
+      break;
+
+    default:
+      __set_errno (EINVAL);
+      result = -1;
+      break;
+    }
+
+  req->result = result;
+  req->error = result < 0 ? errno : 0;
+}
+
+
+/* Cleanup handler of the notification thread, for a notification
+   function which calls pthread_exit.  The next notification starts a new
+   thread.  */
+static void
+kernel_notify_cleanup (void *arg)
+{
+  pthread_mutex_lock (&kernel_notify_lock);
+  kernel_notify_running = 0;
+  pthread_mutex_unlock (&kernel_notify_lock);
+}
+
+
+/* Thread function of the notification thread.  Runs the queued
+   SIGEV_THREAD notifications one after the other.  */
+static void *
+kernel_notify_func (void *arg)
+{
+  struct kernel_notify notify;
+
+  pthread_setcancelstate (PTHREAD_CANCEL_DISABLE, NULL);
+  pthread_cleanup_push (kernel_notify_cleanup, NULL);
+  while (1)
+    {
+      pthread_mutex_lock (&kernel_notify_lock);
+      while (kernel_notify_count == 0)
+	pthread_cond_wait (&kernel_notify_cond, &kernel_notify_lock);
+      notify = kernel_notify_queue[kernel_notify_head];
+      kernel_notify_head = (kernel_notify_head + 1) % TIMER_MAX;
+      kernel_notify_count--;
+      if (kernel_notify_queued[notify.id] == notify.gen)
+	kernel_notify_queued[notify.id] = 0;
+      pthread_mutex_unlock (&kernel_notify_lock);
+
+      notify.function (notify.value);
+    }
+  pthread_cleanup_pop (0);
+  return NULL;
+}
+
+
+/* Queue the SIGEV_THREAD notification of TIMER, with slot ID and
+   generation GEN, and start the notification thread if it is not
+   running.  Runs in the helper thread.  */
+static void
+kernel_queue_notify (struct timer_node *timer, int id, unsigned int gen)
+{
+  pthread_t th;
+
+  pthread_mutex_lock (&kernel_notify_lock);
+  /* The queue can only be full if timers are deleted and created again
+     while a notification function blocks; then the notification is
+     lost, and the overrun count of the next one does not include it.  */
+  if (kernel_notify_queued[id] != gen && kernel_notify_count < TIMER_MAX)
+    {
+      struct kernel_notify *notify
+	= &kernel_notify_queue[(kernel_notify_head + kernel_notify_count)
+			       % TIMER_MAX];
+
+      notify->function = timer->event.sigev_notify_function;
+      notify->value = timer->event.sigev_value;
+      notify->id = id;
+      notify->gen = gen;
+      kernel_notify_count++;
+      kernel_notify_queued[id] = gen;
+      pthread_cond_signal (&kernel_notify_cond);
+    }
+  /* If the thread cannot be created, the next expiry tries again.  */
+  if (!kernel_notify_running
+      && pthread_create (&th, &kernel_notify_attr, kernel_notify_func,
+			 NULL) == 0)
+    kernel_notify_running = 1;
+  pthread_mutex_unlock (&kernel_notify_lock);
+}
+
+
+/* Deliver the notification of the timer with signal value VALUE.  Runs
+   in the helper thread.  The timer cannot be deleted meanwhile, since
+   its deletion is also carried out by this thread.  A signal that was
+   queued before its timer was deleted no longer matches the generation
+   of the slot and is dropped.  */
+static void
+kernel_expire_timer (int value, int overrun)
+{
+  int id = value % TIMER_MAX;
+  unsigned int gen = value / TIMER_MAX;
+  struct timer_node *timer = timer_id2ptr (id);
+
+  if (value < 0 || timer == NULL || timer->ktimerid < 0
+      || timer->kgen != gen)
+    return;
+
+  switch (timer->event.sigev_notify)
+    {
+    case SIGEV_SIGNAL:
+      {
+	siginfo_t info;
+
+	memset (&info, 0, sizeof (siginfo_t));
+	info.si_signo = timer->event.sigev_signo;
+	info.si_code = SI_TIMER;
+	info.si_overrun = overrun;
+	info.si_value = timer->event.sigev_value;
+
+	INLINE_SYSCALL (rt_sigqueueinfo, 3, timer->creator_pid, info.si_signo,
+			&info);
+      }
+      break;
+
+    case SIGEV_THREAD:
+      kernel_queue_notify (timer, id, gen);
+      break;
+
+    default:
+      break;
+    }
+}
+
+
+/* Thread function of the helper thread.  */
+static void *
+__attribute__ ((noreturn))
+kernel_thread_func (void *arg)
+{
+  struct kernel_request *req;
+  siginfo_t info;
+  sigset_t set;
+
+  sigemptyset (&set);
+  sigaddset (&set, __pthread_sig_timer);
+  pthread_sigmask (SIG_BLOCK, &set, NULL);
+
+  pthread_attr_init (&kernel_notify_attr);
+  pthread_attr_setdetachstate (&kernel_notify_attr, PTHREAD_CREATE_DETACHED);
+
+  pthread_mutex_lock (&kernel_done_lock);
+  kernel_pid = getpid ();
+  pthread_cond_broadcast (&kernel_done_cond);
+  pthread_mutex_unlock (&kernel_done_lock);
+
+  while (1)
+    {
+      if (sigwaitinfo (&set, &info) < 0)
+	continue;
+
+      if (info.si_code == SI_TIMER)
+	kernel_expire_timer (info.si_value.sival_int, info.si_overrun);
+
+      /* Any other signal announces a request.  Look for one after
+	 every signal, so that a request is never left waiting for its
+	 own signal behind a running notification.  */
+      pthread_mutex_lock (&kernel_done_lock);
+      req = kernel_req;
+      if (req != NULL && !req->done)
+	{
+	  pthread_mutex_unlock (&kernel_done_lock);
+	  kernel_execute (req);
+	  pthread_mutex_lock (&kernel_done_lock);
+	  req->done = 1;
+	  pthread_cond_broadcast (&kernel_done_cond);
+	}
+      pthread_mutex_unlock (&kernel_done_lock);
+    }
+}
+
+
+/* Start the helper thread.  kernel_req_lock must be held.  */
+static int
+kernel_start (void)
+{
+  pthread_attr_t attr;
+  int retval = 0;
+
+  if (kernel_pid != 0)
+    return 0;
+
+  if (__pthread_sig_timer <= 0)
+    {
+      __set_errno (ENOSYS);
+      return -1;
+    }
+
+  pthread_attr_init (&attr);
+  pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED);
+  if (pthread_create (&kernel_thread, &attr, kernel_thread_func, NULL) != 0)
+    {
+      __set_errno (EAGAIN);
+      retval = -1;
+    }
+  else
+    {
+      pthread_mutex_lock (&kernel_done_lock);
+      while (kernel_pid == 0)
+	pthread_cond_wait (&kernel_done_cond, &kernel_done_lock);
+      pthread_mutex_unlock (&kernel_done_lock);
+    }
+  pthread_attr_destroy (&attr);
+
+  return retval;
+}
+
+
+/* Have the helper thread carry out REQ and wait for the result.  */
+static int
+kernel_request (struct kernel_request *req)
+{
+  int oldstate;
+
+  req->done = 0;
+  pthread_setcancelstate (PTHREAD_CANCEL_DISABLE, &oldstate);
+  pthread_mutex_lock (&kernel_req_lock);
+
+  pthread_mutex_lock (&kernel_done_lock);
+  kernel_req = req;
+  pthread_mutex_unlock (&kernel_done_lock);
+
+  kill (kernel_pid, __pthread_sig_timer);
+
+  pthread_mutex_lock (&kernel_done_lock);
+  while (!req->done)
+    pthread_cond_wait (&kernel_done_cond, &kernel_done_lock);
+  kernel_req = NULL;
+  pthread_mutex_unlock (&kernel_done_lock);
+
+  pthread_mutex_unlock (&kernel_req_lock);
+  pthread_setcancelstate (oldstate, NULL);
+
+  if (req->result < 0)
+    __set_errno (req->error);
+  return req->result;
+}
+
+
+/* Create a kernel timer for TIMER, whose clock and event must be set.
+   Returns -1 if the timer has to be emulated.  The global mutex must
+   not be held by the caller.  */
+int
+__timer_kernel_create (struct timer_node *timer)
+{
+  struct kernel_request req;
+  int retval;
+
+  if (timer->clock != CLOCK_REALTIME)
+    {
+      __set_errno (EINVAL);
+      return -1;
+    }
+
+  if (kernel_no_timers)
+    {
+      __set_errno (ENOSYS);
+      return -1;
+    }
+
+  if (kernel_pid == 0)
+    {
+      pthread_mutex_lock (&kernel_req_lock);
+      retval = kernel_start ();
+      pthread_mutex_unlock (&kernel_req_lock);
+      if (retval < 0)
+	return -1;
+    }
+
+  req.op = TIMER_OP_CREATE;
+  req.timer = timer;
+  retval = kernel_request (&req);
+  if (retval < 0 && errno == ENOSYS)
+    kernel_no_timers = 1;
+
+  return retval;
+}
+
+
+/* Carry out OP on the kernel timer KTIMERID, which the caller read
+   from its timer node while holding the global mutex.  The global mutex
+   must not be held by the caller.  */
+int
+__timer_kernel_call (int op, int ktimerid, int flags,
+		     const struct itimerspec *value,
+		     struct itimerspec *ovalue)
+{
+  struct kernel_request req;
+
+  req.op = op;
+  req.timer = NULL;
+  req.ktimerid = ktimerid;
+  req.flags = flags;
+  req.value = value;
+  req.ovalue = ovalue;
+
+  return kernel_request (&req);
+}
+
+
+/* Kernel timers are not inherited by a child process, nor are the
+   helper and notification threads.  */
+static void
+kernel_reinit (void)
+{
+  kernel_pid = 0;
+  kernel_req = NULL;
+  pthread_mutex_init (&kernel_req_lock, 0);
+  pthread_mutex_init (&kernel_done_lock, 0);
+  pthread_cond_init (&kernel_done_cond, 0);
+  kernel_notify_head = 0;
+  kernel_notify_count = 0;
+  memset (kernel_notify_queued, 0, sizeof (kernel_notify_queued));
+  kernel_notify_running = 0;
+  pthread_mutex_init (&kernel_notify_lock, 0);
+  pthread_cond_init (&kernel_notify_cond, 0);
+}
+
+#else /* !__NR_timer_create */
+
+int
+__timer_kernel_create (struct timer_node *timer)
+{
+  __set_errno (ENOSYS);
+  return -1;
+}
+
+int
+__timer_kernel_call (int op, int ktimerid, int flags,
+		     const struct itimerspec *value,
+		     struct itimerspec *ovalue)
+{
+  __set_errno (ENOSYS);
+  return -1;
+}
+
+static void
+kernel_reinit (void)
+{
+}
+
+#endif /* __NR_timer_create */
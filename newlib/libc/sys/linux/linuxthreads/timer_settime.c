@@ -36,7 +36,7 @@ timer_settime (timerid, flags, value, ovalue)
   struct thread_node *thread = NULL;
   struct timespec now;
   int have_now = 0, need_wakeup = 0;
-  int retval = -1;
+  int retval = -1, ktimerid = -1;
 
   timer = timer_id2ptr (timerid);
   if (timer == NULL)
@@ -54,6 +54,15 @@ timer_settime (timerid, flags, value, ovalue)
       goto bail;
     }
 
+  pthread_mutex_lock (&__timer_mutex);
+  if (timer_valid (timer))
+    ktimerid = timer->ktimerid;
+  pthread_mutex_unlock (&__timer_mutex);
+
+  if (ktimerid >= 0)
+    return __timer_kernel_call (TIMER_OP_SETTIME, ktimerid, flags, value,
+				ovalue);
+
   /* Will need to know current time since this is a relative timer;
      might as well make the system call outside of the lock now! */
 
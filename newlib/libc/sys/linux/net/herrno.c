@@ -1,6 +1,14 @@
+#include <stdlib.h>
 #include <reent.h>
 
 int *__h_errno_location() {
+#ifdef _REENT_SMALL
+  struct _reent *ptr = _REENT;
+
+  _REENT_CHECK_MISC(ptr);
+  return &ptr->_misc->_h_errno;
+#else
   return &(_REENT->_new._reent._h_errno);
+#endif
 }
 
@@ -2,8 +2,11 @@
 
 /* Copyright 2002, Red Hat Inc. */
 
+#define _GNU_SOURCE
 #include <time.h>
 #include <sched.h>
+#include <string.h>
+#include <errno.h>
 #include <machine/syscall.h>
 
 _syscall1(int,sched_get_priority_max,int,policy);
@@ -24,3 +27,84 @@ weak_alias(__libc_sched_getscheduler,__sched_getscheduler);
 weak_alias(__libc_sched_setscheduler,__sched_setscheduler);
 #endif /* !_ELIX_LEVEL || _ELIX_LEVEL >= 3 */
 
+
+#ifdef __NR_sched_setaffinity
+_syscall3(int,sched_setaffinity,pid_t,pid,size_t,cpusetsize,const cpu_set_t *,cpuset);
+weak_alias(__libc_sched_setaffinity,__sched_setaffinity);
+
+static _syscall3_base(int,sched_getaffinity,pid_t,pid,size_t,cpusetsize,cpu_set_t *,cpuset)
+
+/* The kernel returns the size of its own mask; clear the rest of the
+   caller's set so that bits for CPUs the kernel does not know about
+   read as zero.  */
+int
+sched_getaffinity (pid_t pid, size_t cpusetsize, cpu_set_t *cpuset)
+{
+  int res = __libc_sched_getaffinity (pid, cpusetsize, cpuset);
+
+  if (res == -1)
+    return -1;
+  memset ((char *) cpuset + res, 0, cpusetsize - res);
+  return 0;
+}
+#else
+int
+sched_setaffinity (pid_t pid, size_t cpusetsize, const cpu_set_t *cpuset)
+{
+  errno = ENOSYS;
+  return -1;
+}
+
+int
+sched_getaffinity (pid_t pid, size_t cpusetsize, cpu_set_t *cpuset)
+{
+  errno = ENOSYS;
+  return -1;
+}
+
+weak_alias(sched_setaffinity,__sched_setaffinity);
+#endif
+weak_alias(sched_getaffinity,__sched_getaffinity);
+
+int
+__sched_cpucount (size_t setsize, const cpu_set_t *setp)
+{
+  const unsigned char *p = (const unsigned char *) setp;
+  int count = 0;
+  size_t i;
+
+  for (i = 0; i < setsize; i++)
+    {
+      unsigned int b = p[i];
+
+      while (b != 0)
+	{
+	  b &= b - 1;
+	  count++;
+	}
+    }
+  return count;
+}
+
+/* There is no vDSO or restartable sequence support in this port, so
+   every call enters the kernel.  */
+#ifdef __NR_getcpu
+static _syscall3_base(int,getcpu,unsigned int *,cpu,unsigned int *,node,void *,cache)
+
+int
+sched_getcpu (void)
+{
+  unsigned int cpu;
+
+  if (__libc_getcpu (&cpu, NULL, NULL) == -1)
+    return -1;
+  return cpu;
+}
+#else
+int
+sched_getcpu (void)
+{
+  errno = ENOSYS;
+  return -1;
+}
+#endif
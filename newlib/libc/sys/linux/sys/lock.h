@@ -11,6 +11,7 @@
 #endif
 
 #include <bits/libc-lock.h>
+#include <sys/_sdt.h>
 
 typedef __libc_lock_t _LOCK_T;
 typedef __libc_lock_recursive_t _LOCK_RECURSIVE_T;
@@ -22,13 +23,26 @@ typedef __libc_lock_recursive_t _LOCK_RECURSIVE_T;
 
 #define __lock_init(__lock) __libc_lock_init(__lock)
 #define __lock_init_recursive(__lock) __libc_lock_init_recursive(__lock)
-#define __lock_acquire(__lock) __libc_lock_lock(__lock)
-#define __lock_acquire_recursive(__lock) __libc_lock_lock_recursive(__lock)
-#define __lock_release(__lock) __libc_lock_unlock(__lock)
-#define __lock_release_recursive(__lock) __libc_lock_unlock_recursive(__lock)
-#define __lock_try_acquire(__lock) __libc_lock_trylock(__lock)
+/* Probe points for tracing, passing the address of the lock.  The
+   __libc_lock_* macros that lock and unlock are statements.  */
+#define __lock_acquire(__lock) \
+  do { _LIBC_PROBE (lock_acquire, 1, &(__lock)); \
+       __libc_lock_lock(__lock); } while (0)
+#define __lock_acquire_recursive(__lock) \
+  do { _LIBC_PROBE (lock_acquire, 1, &(__lock)); \
+       __libc_lock_lock_recursive(__lock); } while (0)
+#define __lock_release(__lock) \
+  do { _LIBC_PROBE (lock_release, 1, &(__lock)); \
+       __libc_lock_unlock(__lock); } while (0)
+#define __lock_release_recursive(__lock) \
+  do { _LIBC_PROBE (lock_release, 1, &(__lock)); \
+       __libc_lock_unlock_recursive(__lock); } while (0)
+#define __lock_try_acquire(__lock) \
+  _LIBC_PROBE_EXPR (__libc_lock_trylock(__lock), \
+		    lock_try_acquire, 1, &(__lock))
 #define __lock_try_acquire_recursive(__lock) \
-	__libc_lock_trylock_recursive(__lock)
+  _LIBC_PROBE_EXPR (__libc_lock_trylock_recursive(__lock), \
+		    lock_try_acquire, 1, &(__lock))
 #define __lock_close(__lock) __libc_lock_fini(__lock)
 #define __lock_close_recursive(__lock) __libc_lock_fini_recursive(__lock)
 
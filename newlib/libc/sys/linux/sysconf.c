@@ -2,13 +2,63 @@
 
 /* Copyright 2002, Red Hat Inc. */
 
+#define _GNU_SOURCE
 
 #include <unistd.h>
+#include <stdlib.h>
 #include <limits.h>
 #include <time.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
 #include <sys/types.h>
 
+/* Count the CPUs in a list like "0-3,6,8-11" as found in
+   /sys/devices/system/cpu.  Return 0 if the file cannot be read.  */
+static long
+count_cpu_list (const char *path)
+{
+  char buf[256];
+  char *p, *end;
+  unsigned long lo, hi;
+  long count = 0;
+  int fd, n;
+
+  fd = open (path, O_RDONLY);
+  if (fd < 0)
+    return 0;
+  n = read (fd, buf, sizeof (buf) - 1);
+  close (fd);
+  if (n <= 0)
+    return 0;
+  buf[n] = '\0';
+
+  p = buf;
+  while (*p >= '0' && *p <= '9')
+    {
+      lo = hi = strtoul (p, &end, 10);
+      if (*end == '-')
+	hi = strtoul (end + 1, &end, 10);
+      if (hi >= lo)
+	count += hi - lo + 1;
+      p = *end == ',' ? end + 1 : end;
+    }
+  return count;
+}
+
+/* Fall back to the affinity mask of the process when sysfs is not
+   mounted.  */
+static long
+count_cpus (const char *path)
+{
+  long count = count_cpu_list (path);
+  cpu_set_t set;
+
+  if (count == 0 && sched_getaffinity (0, sizeof (set), &set) == 0)
+    count = CPU_COUNT (&set);
+  return count > 0 ? count : 1;
+}
+
 long int 
 sysconf (int name)
 {
@@ -374,6 +424,32 @@ sysconf (int name)
       return -1;
 #endif
 
+    case _SC_NPROCESSORS_CONF:
+      {
+	/* CPUs are not added to the possible set while running.  */
+	static long nprocessors_conf;
+
+	if (nprocessors_conf == 0)
+	  nprocessors_conf = count_cpus ("/sys/devices/system/cpu/possible");
+	return nprocessors_conf;
+      }
+
+    case _SC_NPROCESSORS_ONLN:
+      {
+	/* CPUs may go on- and offline; read the list again at most
+	   once a second.  */
+	static long nprocessors_onln;
+	static time_t onln_stamp;
+	time_t now = time (NULL);
+
+	if (nprocessors_onln == 0 || now != onln_stamp)
+	  {
+	    nprocessors_onln = count_cpus ("/sys/devices/system/cpu/online");
+	    onln_stamp = now;
+	  }
+	return nprocessors_onln;
+      }
+
     default:
       errno = EINVAL;
       return -1;
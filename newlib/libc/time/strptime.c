@@ -153,301 +153,277 @@ set_week_number_mon4 (struct tm *timeptr, int wnum)
     }
 }
 
-char *
-strptime_l (const char *buf, const char *format, struct tm *timeptr,
-	    locale_t locale)
+/*
+ * Parse a decimal number the way strtol_l does.  Runs of plain digits
+ * which cannot overflow an int are decoded directly; leading white
+ * space, signs and longer runs go through strtol_l.
+ * Needed for strptime.
+ */
+static int
+get_number (const char **bufp, int *val, locale_t locale)
 {
-    char c;
-    int ymd = 0;
+    const char *buf = *bufp;
+    unsigned int n = 0;
+    char *s;
+    int i;
 
-    const struct lc_time_T *_CurrentTimeLocale = __get_time_locale (locale);
-    for (; (c = *format) != '\0'; ++format) {
-	char *s;
-	int ret;
+    for (i = 0; i < 9 && (unsigned) (buf[i] - '0') <= 9; ++i)
+	n = n * 10 + (buf[i] - '0');
+    if (i > 0 && (unsigned) (buf[i] - '0') > 9) {
+	*val = n;
+	*bufp = buf + i;
+	return 0;
+    }
+    *val = strtol_l (buf, &s, 10, locale);
+    if (s == buf)
+	return -1;
+    *bufp = s;
+    return 0;
+}
 
-	if (isspace_l ((unsigned char) c, locale)) {
-	    while (isspace_l ((unsigned char) *buf, locale))
-		++buf;
-	} else if (c == '%' && format[1] != '\0') {
-	    c = *++format;
-	    if (c == 'E' || c == 'O')
-		c = *++format;
-	    switch (c) {
-	    case 'A' :
-		ret = match_string (&buf, _ctloc (weekday), locale);
-		if (ret < 0)
-		    return NULL;
-		timeptr->tm_wday = ret;
-		ymd |= SET_WDAY;
-		break;
-	    case 'a' :
-		ret = match_string (&buf, _ctloc (wday), locale);
-		if (ret < 0)
-		    return NULL;
-		timeptr->tm_wday = ret;
-		ymd |= SET_WDAY;
-		break;
-	    case 'B' :
-		ret = match_string (&buf, _ctloc (month), locale);
-		if (ret < 0)
-		    return NULL;
-		timeptr->tm_mon = ret;
-		ymd |= SET_MON;
-		break;
-	    case 'b' :
-	    case 'h' :
-		ret = match_string (&buf, _ctloc (mon), locale);
-		if (ret < 0)
-		    return NULL;
-		timeptr->tm_mon = ret;
-		ymd |= SET_MON;
-		break;
-	    case 'C' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_year = (ret * 100) - tm_year_base;
-		buf = s;
-		ymd |= SET_YEAR;
-		break;
-	    case 'c' :		/* %a %b %e %H:%M:%S %Y */
-		s = strptime_l (buf, _ctloc (c_fmt), timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		ymd |= SET_WDAY | SET_YMD;
-		break;
-	    case 'D' :		/* %m/%d/%y */
-		s = strptime_l (buf, "%m/%d/%y", timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		ymd |= SET_YMD;
-		break;
-	    case 'd' :
-	    case 'e' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_mday = ret;
-		buf = s;
-		ymd |= SET_MDAY;
-		break;
-	    case 'F' :		/* %Y-%m-%d - GNU extension */
-		s = strptime_l (buf, "%Y-%m-%d", timeptr, locale);
-		if (s == NULL || s == buf)
-		    return NULL;
-		buf = s;
-		ymd |= SET_YMD;
-		break;
-	    case 'H' :
-	    case 'k' :		/* hour with leading space - GNU extension */
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_hour = ret;
-		buf = s;
-		break;
-	    case 'I' :
-	    case 'l' :		/* hour with leading space - GNU extension */
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		if (ret == 12)
-		    timeptr->tm_hour = 0;
-		else
-		    timeptr->tm_hour = ret;
-		buf = s;
-		break;
-	    case 'j' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_yday = ret - 1;
-		buf = s;
-		ymd |= SET_YDAY;
-		break;
-	    case 'm' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_mon = ret - 1;
-		buf = s;
-		ymd |= SET_MON;
-		break;
-	    case 'M' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_min = ret;
-		buf = s;
-		break;
-	    case 'n' :
-		if (*buf == '\n')
-		    ++buf;
-		else
-		    return NULL;
-		break;
-	    case 'p' :
-		ret = match_string (&buf, _ctloc (am_pm), locale);
-		if (ret < 0)
-		    return NULL;
-		if (timeptr->tm_hour == 0) {
-		    if (ret == 1)
-			timeptr->tm_hour = 12;
-		} else
-		    timeptr->tm_hour += 12;
-		break;
-	    case 'r' :		/* %I:%M:%S %p */
-		s = strptime_l (buf, _ctloc (ampm_fmt), timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		break;
-	    case 'R' :		/* %H:%M */
-		s = strptime_l (buf, "%H:%M", timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		break;
-	    case 's' :		/* seconds since Unix epoch - GNU extension */
-		{
-		    long long sec;
-		    time_t t;
-		    int save_errno;
-
-		    save_errno = errno;
-		    errno = 0;
-		    sec = strtoll_l (buf, &s, 10, locale);
-		    t = sec;
-		    if (s == buf
-			|| errno != 0
-			|| t != sec
-			|| localtime_r (&t, timeptr) != timeptr)
-			return NULL;
-		    errno = save_errno;
-		    buf = s;
-		    ymd |= SET_YDAY | SET_WDAY | SET_YMD;
-		    break;
-		}
-	    case 'S' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_sec = ret;
-		buf = s;
-		break;
-	    case 't' :
-		if (*buf == '\t')
-		    ++buf;
-		else
-		    return NULL;
-		break;
-	    case 'T' :		/* %H:%M:%S */
-		s = strptime_l (buf, "%H:%M:%S", timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		break;
-	    case 'u' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_wday = ret - 1;
-		buf = s;
-		ymd |= SET_WDAY;
-		break;
-	    case 'w' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_wday = ret;
-		buf = s;
-		ymd |= SET_WDAY;
-		break;
-	    case 'U' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		set_week_number_sun (timeptr, ret);
-		buf = s;
-		ymd |= SET_YDAY;
-		break;
-	    case 'V' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		set_week_number_mon4 (timeptr, ret);
-		buf = s;
-		ymd |= SET_YDAY;
-		break;
-	    case 'W' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		set_week_number_mon (timeptr, ret);
-		buf = s;
-		ymd |= SET_YDAY;
-		break;
-	    case 'x' :
-		s = strptime_l (buf, _ctloc (x_fmt), timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-		ymd |= SET_YMD;
-		break;
-	    case 'X' :
-		s = strptime_l (buf, _ctloc (X_fmt), timeptr, locale);
-		if (s == NULL)
-		    return NULL;
-		buf = s;
-	    	break;
-	    case 'y' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		if (ret < 70)
-		    timeptr->tm_year = 100 + ret;
-		else
-		    timeptr->tm_year = ret;
-		buf = s;
-		ymd |= SET_YEAR;
-		break;
-	    case 'Y' :
-		ret = strtol_l (buf, &s, 10, locale);
-		if (s == buf)
-		    return NULL;
-		timeptr->tm_year = ret - tm_year_base;
-		buf = s;
-		ymd |= SET_YEAR;
-		break;
-	    case 'Z' :
-		/* Unsupported. Just ignore.  */
-		break;
-	    case '\0' :
-		--format;
-		/* FALLTHROUGH */
-	    case '%' :
-		if (*buf == '%')
-		    ++buf;
-		else
-		    return NULL;
-		break;
-	    default :
-		if (*buf == '%' || *++buf == c)
-		    ++buf;
-		else
-		    return NULL;
-		break;
-	    }
-	} else {
-	    if (*buf == c)
-		++buf;
-	    else
+/*
+ * Return the format a conversion is a shorthand for and set `ymd' to
+ * the fields it fills in, or return NULL if `c' is no shorthand.
+ * Needed for strptime.
+ */
+static const char *
+expand_conversion (int c, const struct lc_time_T *_CurrentTimeLocale,
+		   int *ymd)
+{
+    switch (c) {
+    case 'c' :		/* %a %b %e %H:%M:%S %Y */
+	*ymd = SET_WDAY | SET_YMD;
+	return _ctloc (c_fmt);
+    case 'D' :
+	*ymd = SET_YMD;
+	return "%m/%d/%y";
+    case 'F' :		/* GNU extension */
+	*ymd = SET_YMD;
+	return "%Y-%m-%d";
+    case 'r' :		/* %I:%M:%S %p */
+	*ymd = 0;
+	return _ctloc (ampm_fmt);
+    case 'R' :
+	*ymd = 0;
+	return "%H:%M";
+    case 'T' :
+	*ymd = 0;
+	return "%H:%M:%S";
+    case 'x' :
+	*ymd = SET_YMD;
+	return _ctloc (x_fmt);
+    case 'X' :
+	*ymd = 0;
+	return _ctloc (X_fmt);
+    }
+    return NULL;
+}
+
+/*
+ * Parse the input of conversion `c', which is no shorthand.  Return the
+ * rest of the input or NULL if it does not match.
+ * Needed for strptime.
+ */
+static const char *
+parse_conversion (const char *buf, int c, struct tm *timeptr, int *ymd,
+		  locale_t locale, const struct lc_time_T *_CurrentTimeLocale)
+{
+    int ret;
+
+    switch (c) {
+    case 'A' :
+	ret = match_string (&buf, _ctloc (weekday), locale);
+	if (ret < 0)
+	    return NULL;
+	timeptr->tm_wday = ret;
+	*ymd |= SET_WDAY;
+	break;
+    case 'a' :
+	ret = match_string (&buf, _ctloc (wday), locale);
+	if (ret < 0)
+	    return NULL;
+	timeptr->tm_wday = ret;
+	*ymd |= SET_WDAY;
+	break;
+    case 'B' :
+	ret = match_string (&buf, _ctloc (month), locale);
+	if (ret < 0)
+	    return NULL;
+	timeptr->tm_mon = ret;
+	*ymd |= SET_MON;
+	break;
+    case 'b' :
+    case 'h' :
+	ret = match_string (&buf, _ctloc (mon), locale);
+	if (ret < 0)
+	    return NULL;
+	timeptr->tm_mon = ret;
+	*ymd |= SET_MON;
+	break;
+    case 'C' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_year = (ret * 100) - tm_year_base;
+	*ymd |= SET_YEAR;
+	break;
+    case 'd' :
+    case 'e' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_mday = ret;
+	*ymd |= SET_MDAY;
+	break;
+    case 'H' :
+    case 'k' :		/* hour with leading space - GNU extension */
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_hour = ret;
+	break;
+    case 'I' :
+    case 'l' :		/* hour with leading space - GNU extension */
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	if (ret == 12)
+	    timeptr->tm_hour = 0;
+	else
+	    timeptr->tm_hour = ret;
+	break;
+    case 'j' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_yday = ret - 1;
+	*ymd |= SET_YDAY;
+	break;
+    case 'm' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_mon = ret - 1;
+	*ymd |= SET_MON;
+	break;
+    case 'M' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_min = ret;
+	break;
+    case 'n' :
+	if (*buf == '\n')
+	    ++buf;
+	else
+	    return NULL;
+	break;
+    case 'p' :
+	ret = match_string (&buf, _ctloc (am_pm), locale);
+	if (ret < 0)
+	    return NULL;
+	if (timeptr->tm_hour == 0) {
+	    if (ret == 1)
+		timeptr->tm_hour = 12;
+	} else
+	    timeptr->tm_hour += 12;
+	break;
+    case 's' :		/* seconds since Unix epoch - GNU extension */
+	{
+	    long long sec;
+	    time_t t;
+	    int save_errno;
+	    char *s;
+
+	    save_errno = errno;
+	    errno = 0;
+	    sec = strtoll_l (buf, &s, 10, locale);
+	    t = sec;
+	    if (s == buf
+		|| errno != 0
+		|| t != sec
+		|| localtime_r (&t, timeptr) != timeptr)
 		return NULL;
+	    errno = save_errno;
+	    buf = s;
+	    *ymd |= SET_YDAY | SET_WDAY | SET_YMD;
+	    break;
 	}
+    case 'S' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_sec = ret;
+	break;
+    case 't' :
+	if (*buf == '\t')
+	    ++buf;
+	else
+	    return NULL;
+	break;
+    case 'u' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_wday = ret - 1;
+	*ymd |= SET_WDAY;
+	break;
+    case 'w' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_wday = ret;
+	*ymd |= SET_WDAY;
+	break;
+    case 'U' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	set_week_number_sun (timeptr, ret);
+	*ymd |= SET_YDAY;
+	break;
+    case 'V' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	set_week_number_mon4 (timeptr, ret);
+	*ymd |= SET_YDAY;
+	break;
+    case 'W' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	set_week_number_mon (timeptr, ret);
+	*ymd |= SET_YDAY;
+	break;
+    case 'y' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	if (ret < 70)
+	    timeptr->tm_year = 100 + ret;
+	else
+	    timeptr->tm_year = ret;
+	*ymd |= SET_YEAR;
+	break;
+    case 'Y' :
+	if (get_number (&buf, &ret, locale) < 0)
+	    return NULL;
+	timeptr->tm_year = ret - tm_year_base;
+	*ymd |= SET_YEAR;
+	break;
+    case 'Z' :
+	/* Unsupported. Just ignore.  */
+	break;
+    case '%' :
+	if (*buf == '%')
+	    ++buf;
+	else
+	    return NULL;
+	break;
+    default :
+	if (*buf == '%' || *++buf == c)
+	    ++buf;
+	else
+	    return NULL;
+	break;
     }
+    return buf;
+}
 
+/*
+ * Fill in the fields of `timeptr' which follow from the ones parsed.
+ * Needed for strptime.
+ */
+static void
+complete_tm (struct tm *timeptr, int ymd)
+{
     if ((ymd & SET_YMD) == SET_YMD) {
 	/* all of tm_year, tm_mon and tm_mday, but... */
 
@@ -498,10 +474,222 @@ strptime_l (const char *buf, const char *format, struct tm *timeptr,
 	int fday = first_day (timeptr->tm_year + tm_year_base);
 	timeptr->tm_wday = (fday + timeptr->tm_yday) % 7;
     }
+}
+
+char *
+strptime_l (const char *buf, const char *format, struct tm *timeptr,
+	    locale_t locale)
+{
+    char c;
+    int ymd = 0;
+
+    const struct lc_time_T *_CurrentTimeLocale = __get_time_locale (locale);
+    for (; (c = *format) != '\0'; ++format) {
+	const char *fmt;
+	char *s;
+	int set;
+
+	if (isspace_l ((unsigned char) c, locale)) {
+	    while (isspace_l ((unsigned char) *buf, locale))
+		++buf;
+	} else if (c == '%' && format[1] != '\0') {
+	    c = *++format;
+	    if (c == 'E' || c == 'O')
+		c = *++format;
+	    if (c == '\0') {
+		--format;
+		c = '%';
+	    }
+	    fmt = expand_conversion (c, _CurrentTimeLocale, &set);
+	    if (fmt != NULL) {
+		s = strptime_l (buf, fmt, timeptr, locale);
+		if (s == NULL || (c == 'F' && s == buf))
+		    return NULL;
+		buf = s;
+		ymd |= set;
+	    } else {
+		buf = parse_conversion (buf, c, timeptr, &ymd, locale,
+					_CurrentTimeLocale);
+		if (buf == NULL)
+		    return NULL;
+	    }
+	} else {
+	    if (*buf == c)
+		++buf;
+	    else
+		return NULL;
+	}
+    }
+
+    complete_tm (timeptr, ymd);
+    return (char *)buf;
+}
+
+/*
+ * Compiled formats for strptime_exec.  Each operation corresponds to one
+ * step of strptime_l; shorthand conversions refer to their own compiled
+ * format, so the fields they imply are completed the same way.
+ */
+#define OP_END		0	/* end of format */
+#define OP_SPACE	1	/* skip white space */
+#define OP_CHAR		2	/* match character `c' */
+#define OP_CONV		3	/* parse conversion `c' */
+#define OP_FORMAT	4	/* parse shorthand conversion `c' using `sub' */
+
+struct strptime_op {
+    char type;
+    char c;
+    char ymd;			/* fields set by a shorthand conversion */
+    struct strptime_op *sub;
+};
+
+struct __strptime_format {
+    locale_t locale;
+    struct strptime_op *ops;
+};
+
+static void
+free_format (struct strptime_op *ops)
+{
+    struct strptime_op *op;
+
+    for (op = ops; op->type != OP_END; ++op)
+	if (op->type == OP_FORMAT)
+	    free_format (op->sub);
+    free (ops);
+}
+
+static struct strptime_op *
+compile_format (const char *format, locale_t locale,
+		const struct lc_time_T *_CurrentTimeLocale)
+{
+    struct strptime_op *ops, *op;
+    const char *fmt;
+    char c;
+    int set;
+
+    /* Every character of the format yields at most one operation.  */
+    ops = malloc ((strlen (format) + 1) * sizeof (*ops));
+    if (ops == NULL)
+	return NULL;
+    for (op = ops; (c = *format) != '\0'; ++format) {
+	if (isspace_l ((unsigned char) c, locale)) {
+	    /* Further white space would not skip anything.  */
+	    if (op > ops && op[-1].type == OP_SPACE)
+		continue;
+	    op->type = OP_SPACE;
+	} else if (c == '%' && format[1] != '\0') {
+	    c = *++format;
+	    if (c == 'E' || c == 'O')
+		c = *++format;
+	    if (c == '\0') {
+		--format;
+		c = '%';
+	    }
+	    fmt = expand_conversion (c, _CurrentTimeLocale, &set);
+	    if (fmt != NULL) {
+		op->sub = compile_format (fmt, locale, _CurrentTimeLocale);
+		if (op->sub == NULL) {
+		    op->type = OP_END;
+		    free_format (ops);
+		    return NULL;
+		}
+		op->type = OP_FORMAT;
+		op->ymd = set;
+	    } else
+		op->type = OP_CONV;
+	} else
+	    op->type = OP_CHAR;
+	op->c = c;
+	++op;
+    }
+    op->type = OP_END;
+    return ops;
+}
+
+static char *
+exec_format (const char *buf, const struct strptime_op *op,
+	     struct tm *timeptr, locale_t locale,
+	     const struct lc_time_T *_CurrentTimeLocale)
+{
+    int ymd = 0;
+    char *s;
+
+    for (; op->type != OP_END; ++op) {
+	switch (op->type) {
+	case OP_SPACE :
+	    while (isspace_l ((unsigned char) *buf, locale))
+		++buf;
+	    break;
+	case OP_CHAR :
+	    if (*buf == op->c)
+		++buf;
+	    else
+		return NULL;
+	    break;
+	case OP_CONV :
+	    buf = parse_conversion (buf, op->c, timeptr, &ymd, locale,
+				    _CurrentTimeLocale);
+	    if (buf == NULL)
+		return NULL;
+	    break;
+	case OP_FORMAT :
+	    s = exec_format (buf, op->sub, timeptr, locale,
+			     _CurrentTimeLocale);
+	    if (s == NULL || (op->c == 'F' && s == buf))
+		return NULL;
+	    buf = s;
+	    ymd |= op->ymd;
+	    break;
+	}
+    }
 
+    complete_tm (timeptr, ymd);
     return (char *)buf;
 }
 
+/*
+ * Compile `format' for repeated use with strptime_exec, which then
+ * behaves like strptime_l with the same format and locale.  A null
+ * `locale' stands for the current locale.  The formats of %c, %r, %x
+ * and %X are taken from the locale when the format is compiled.
+ */
+strptime_format_t *
+strptime_compile (const char *format, locale_t locale)
+{
+    strptime_format_t *cf;
+    locale_t loc = locale ? locale : __get_current_locale ();
+
+    cf = malloc (sizeof (*cf));
+    if (cf == NULL)
+	return NULL;
+    cf->locale = locale;
+    cf->ops = compile_format (format, loc, __get_time_locale (loc));
+    if (cf->ops == NULL) {
+	free (cf);
+	return NULL;
+    }
+    return cf;
+}
+
+char *
+strptime_exec (const char *buf, const strptime_format_t *cf,
+	       struct tm *timeptr)
+{
+    locale_t loc = cf->locale ? cf->locale : __get_current_locale ();
+
+    return exec_format (buf, cf->ops, timeptr, loc, __get_time_locale (loc));
+}
+
+void
+strptime_format_free (strptime_format_t *cf)
+{
+    if (cf == NULL)
+	return;
+    free_format (cf->ops);
+    free (cf);
+}
+
 char *
 strptime (const char *buf, const char *format, struct tm *timeptr)
 {
@@ -5,6 +5,7 @@
 #include <string.h>
 #include <sys/types.h>
 #include <sys/time.h>
+#include <sys/_sdt.h>
 #include "local.h"
 
 #define sscanf siscanf	/* avoid to pull in FP functions. */
@@ -36,6 +37,8 @@ _tzset_unlocked_r (struct _reent *reent_ptr)
   if (prev_tzenv != NULL && strcmp(tzenv, prev_tzenv) == 0)
     return;
 
+  _LIBC_PROBE (tzset_reload, 1, tzenv);
+
   free(prev_tzenv);
   prev_tzenv = _malloc_r (reent_ptr, strlen(tzenv) + 1);
   if (prev_tzenv != NULL)
@@ -33,10 +33,14 @@
  *
  * This set of routines implements a XDR on a stdio stream.
  * XDR_ENCODE serializes onto the stream, XDR_DECODE de-serializes
- * from the stream.
+ * from the stream.  The data is copied to and from the stdio buffer
+ * of the stream directly, under the stream lock.
  */
 
 #include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
 
 #include <rpc/types.h>
 #include <rpc/xdr.h>
@@ -105,13 +109,56 @@ xdrstdio_destroy (XDR * xdrs)
   /* XXX: should we close the file ?? */
 }
 
+/*
+ * The primitives below lock the stream once and move the data through
+ * the stream buffer directly.  Only when the buffer is exhausted (or
+ * full) do they go through fread or fwrite, to refill or flush it.
+ * A stream which has a buffer in use always has a positive _r while
+ * reading and, if fully buffered, a positive _w while writing.
+ */
+
+static bool_t
+get_unlocked (FILE * fp,
+	void *addr,
+	u_int len)
+{
+  if (fp->_r >= (int) len)
+    {
+      memcpy (addr, fp->_p, len);
+      fp->_p += len;
+      fp->_r -= len;
+      return TRUE;
+    }
+  return fread_unlocked (addr, (size_t) len, 1, fp) == 1;
+}
+
+static bool_t
+put_unlocked (FILE * fp,
+	const void *addr,
+	u_int len)
+{
+  if (fp->_w >= (int) len)
+    {
+      memcpy (fp->_p, addr, len);
+      fp->_p += len;
+      fp->_w -= len;
+      return TRUE;
+    }
+  return fwrite_unlocked (addr, (size_t) len, 1, fp) == 1;
+}
+
 static bool_t
 xdrstdio_getlong (XDR * xdrs,
 	long *lp)
 {
+  FILE *fp = (FILE *) xdrs->x_private;
   u_int32_t temp;
+  bool_t ret;
 
-  if (fread (&temp, sizeof (int32_t), 1, (FILE *) xdrs->x_private) != 1)
+  flockfile (fp);
+  ret = get_unlocked (fp, &temp, sizeof (int32_t));
+  funlockfile (fp);
+  if (!ret)
     return FALSE;
   *lp = (long) (int32_t) ntohl (temp);
   return TRUE;
@@ -121,11 +168,14 @@ static bool_t
 xdrstdio_putlong (XDR * xdrs,
 	const long *lp)
 {
+  FILE *fp = (FILE *) xdrs->x_private;
   u_int32_t temp = htonl ((u_int32_t) * lp);
+  bool_t ret;
 
-  if (fwrite (&temp, sizeof (int32_t), 1, (FILE *) xdrs->x_private) != 1)
-    return FALSE;
-  return TRUE;
+  flockfile (fp);
+  ret = put_unlocked (fp, &temp, sizeof (int32_t));
+  funlockfile (fp);
+  return ret;
 }
 
 static bool_t
@@ -133,10 +183,15 @@ xdrstdio_getbytes (XDR * xdrs,
         char *addr,
 	u_int len)
 {
-  if ((len != 0) && (fread (addr, (size_t) len, 1,
-                            (FILE *) xdrs->x_private) != 1))
-    return FALSE;
-  return TRUE;
+  FILE *fp = (FILE *) xdrs->x_private;
+  bool_t ret;
+
+  if (len == 0)
+    return TRUE;
+  flockfile (fp);
+  ret = get_unlocked (fp, addr, len);
+  funlockfile (fp);
+  return ret;
 }
 
 static bool_t
@@ -144,10 +199,15 @@ xdrstdio_putbytes (XDR * xdrs,
         const char *addr,
 	u_int len)
 {
-  if ((len != 0) && (fwrite (addr, (size_t) len, 1,
-                             (FILE *) xdrs->x_private) != 1))
-    return FALSE;
-  return TRUE;
+  FILE *fp = (FILE *) xdrs->x_private;
+  bool_t ret;
+
+  if (len == 0)
+    return TRUE;
+  flockfile (fp);
+  ret = put_unlocked (fp, addr, len);
+  funlockfile (fp);
+  return ret;
 }
 
 static u_int
@@ -164,30 +224,55 @@ xdrstdio_setpos (XDR * xdrs,
           FALSE : TRUE);
 }
 
-/* ARGSUSED */
+/*
+ * Hand out the next len bytes of the stdio buffer if they are already
+ * there (or, when encoding, if the buffer has room for them) and
+ * suitably aligned, and consume them.  As for the other XDR streams,
+ * the pointer is only valid until the next operation on the stream.
+ * At a buffer boundary return NULL, so that the caller falls back to
+ * the primitives, which refill or flush the buffer.
+ */
 static int32_t *
 xdrstdio_inline (XDR * xdrs,
 	u_int len)
 {
-  /*
-   * Must do some work to implement this: must insure
-   * enough data in the underlying stdio buffer,
-   * that the buffer is aligned so that we can indirect through a
-   * long *, and stuff this pointer in xdrs->x_buf.  Doing
-   * a fread or fwrite to a scratch buffer would defeat
-   * most of the gains to be had here and require storage
-   * management on this buffer, so we don't do this.
-   */
-  return NULL;
+  FILE *fp = (FILE *) xdrs->x_private;
+  int32_t *buf = NULL;
+
+  if (len > INT_MAX)
+    return NULL;
+  flockfile (fp);
+  if (((uintptr_t) fp->_p & (sizeof (int32_t) - 1)) == 0)
+    {
+      if (xdrs->x_op == XDR_DECODE && fp->_r >= (int) len)
+	{
+	  buf = (int32_t *) (void *) fp->_p;
+	  fp->_p += len;
+	  fp->_r -= len;
+	}
+      else if (xdrs->x_op == XDR_ENCODE && fp->_w >= (int) len)
+	{
+	  buf = (int32_t *) (void *) fp->_p;
+	  fp->_p += len;
+	  fp->_w -= len;
+	}
+    }
+  funlockfile (fp);
+  return buf;
 }
 
 static bool_t
 xdrstdio_getint32 (XDR *xdrs,
 	int32_t *ip)
 {
+  FILE *fp = (FILE *) xdrs->x_private;
   int32_t temp;
+  bool_t ret;
 
-  if (fread (&temp, sizeof (int32_t), 1, (FILE *) xdrs->x_private) != 1)
+  flockfile (fp);
+  ret = get_unlocked (fp, &temp, sizeof (int32_t));
+  funlockfile (fp);
+  if (!ret)
     return FALSE;
   *ip = ntohl (temp);
   return TRUE;
@@ -197,10 +282,13 @@ static bool_t
 xdrstdio_putint32 (XDR *xdrs,
 	const int32_t *ip)
 {
+  FILE *fp = (FILE *) xdrs->x_private;
   int32_t temp = htonl (*ip);
+  bool_t ret;
 
-  if (fwrite (&temp, sizeof (int32_t), 1, (FILE *) xdrs->x_private) != 1)
-    return FALSE;
-  return TRUE;
+  flockfile (fp);
+  ret = put_unlocked (fp, &temp, sizeof (int32_t));
+  funlockfile (fp);
+  return ret;
 }
 
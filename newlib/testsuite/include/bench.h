@@ -0,0 +1,91 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Minimal timing harness used by the newlib.bench testsuite.
+
+   Each measurement is emitted as a single tab separated line
+
+     BENCH <name> <param> <iterations> <ns-per-op>
+
+   so that the output of two builds can be compared with
+   newlib.bench/bench-compare.awk.  The iteration count of every
+   measurement is doubled until it runs for at least BENCH_MIN_NSEC,
+   which keeps the suite usable both natively and on slow simulators.  */
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stdio.h>
+#include <time.h>
+
+#ifndef BENCH_MIN_NSEC
+#define BENCH_MIN_NSEC 20000000UL
+#endif
+
+#ifndef BENCH_MAX_ITERS
+#define BENCH_MAX_ITERS (1UL << 24)
+#endif
+
+typedef unsigned long long bench_ns_t;
+
+/* Written by the benchmarks so that the measured work is not optimized
+   away.  */
+static volatile unsigned long bench_sink;
+
+#define BENCH_USE(x) (bench_sink += (unsigned long) (x))
+
+static bench_ns_t
+bench_now (void)
+{
+#if defined (_POSIX_MONOTONIC_CLOCK) && defined (CLOCK_MONOTONIC)
+  struct timespec ts;
+
+  /* Simulators often lack clock_gettime; fall back to clock () then.  */
+  if (clock_gettime (CLOCK_MONOTONIC, &ts) == 0)
+    return (bench_ns_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+  return (bench_ns_t) clock () * (1000000000ULL / CLOCKS_PER_SEC);
+}
+
+static void
+bench_report (const char *name, unsigned long param, unsigned long iters,
+	      bench_ns_t elapsed)
+{
+  /* Hundredths of a nanosecond, printed without relying on long long or
+     floating point support in printf.  */
+  unsigned long cns = (unsigned long) (elapsed * 100 / iters);
+
+  printf ("BENCH\t%s\t%lu\t%lu\t%lu.%02lu\n", name, param, iters,
+	  cns / 100, cns % 100);
+  fflush (stdout);
+}
+
+/* Run the statement(s) given as the trailing arguments repeatedly and
+   report the average time of one execution.  */
+#define BENCH_RUN(name, param, ...)					\
+  do									\
+    {									\
+      unsigned long __bench_n = 1;					\
+      bench_ns_t __bench_t;						\
+									\
+      for (;;)								\
+	{								\
+	  unsigned long __bench_i;					\
+	  bench_ns_t __bench_s = bench_now ();				\
+									\
+	  for (__bench_i = 0; __bench_i < __bench_n; __bench_i++)	\
+	    {								\
+	      __VA_ARGS__;						\
+	    }								\
+	  __bench_t = bench_now () - __bench_s;				\
+	  if (__bench_t >= BENCH_MIN_NSEC				\
+	      || __bench_n >= BENCH_MAX_ITERS)				\
+	    break;							\
+	  __bench_n *= 2;						\
+	}								\
+      bench_report ((name), (param), __bench_n, __bench_t);		\
+    }									\
+  while (0)
+
+#endif /* _BENCH_H_ */
@@ -0,0 +1,40 @@
+# This file is in the public domain.
+
+# Compare two newlib.bench.results files:
+#
+#   awk -f bench-compare.awk [-v threshold=5] old.results new.results
+#
+# Prints the ns/op of both runs and the relative change for every
+# measurement present in both files, marking changes larger than
+# threshold percent.  Exits with status 1 if any measurement got slower
+# by more than the threshold.
+
+BEGIN {
+  FS = "\t"
+  if (threshold == "")
+    threshold = 5
+  slower = 0
+}
+
+$1 != "BENCH" { next }
+
+FNR == NR {
+  old[$2 "\t" $3] = $5
+  next
+}
+
+{
+  key = $2 "\t" $3
+  if (!(key in old) || old[key] == 0)
+    next
+  change = ($5 - old[key]) * 100 / old[key]
+  mark = ""
+  if (change > threshold) {
+    mark = "  SLOWER"
+    slower = 1
+  } else if (change < -threshold)
+    mark = "  faster"
+  printf "%-40s %8s %12s %12s %+7.1f%%%s\n", $2, $3, old[key], $5, change, mark
+}
+
+END { exit slower }
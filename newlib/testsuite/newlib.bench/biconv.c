@@ -0,0 +1,67 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* iconv_open/iconv_close cost and conversion throughput.  Does nothing
+   if newlib was configured without iconv.  */
+
+#include <newlib.h>
+#include <stdio.h>
+#include "bench.h"
+
+#ifdef _ICONV_ENABLED
+#include <iconv.h>
+
+static const char *const pairs[][2] =
+{
+  { "UTF-8", "ISO-8859-1" },
+  { "UTF-8", "UTF-16" },
+  { "UTF-8", "UCS-4" },
+  { "ISO-8859-1", "UTF-8" },
+  { "KOI8-R", "UTF-8" },
+  { "EUC-JP", "UTF-8" },
+};
+#define NPAIRS (sizeof (pairs) / sizeof (pairs[0]))
+
+static char inbuf[1024];
+static char outbuf[4 * sizeof (inbuf) + 16];
+
+int
+main (void)
+{
+  char name[48];
+  unsigned long i;
+
+  for (i = 0; i < sizeof (inbuf); i++)
+    inbuf[i] = 'A' + i % 26;
+
+  for (i = 0; i < NPAIRS; i++)
+    {
+      iconv_t cd = iconv_open (pairs[i][1], pairs[i][0]);
+
+      if (cd == (iconv_t) -1)
+	continue;
+      sprintf (name, "iconv_open/%s/%s", pairs[i][0], pairs[i][1]);
+      BENCH_RUN (name, 0,
+		 iconv_t __cd = iconv_open (pairs[i][1], pairs[i][0]);
+		 iconv_close (__cd));
+      sprintf (name, "iconv/%s/%s", pairs[i][0], pairs[i][1]);
+      BENCH_RUN (name, sizeof (inbuf),
+		 char *__in = inbuf;
+		 char *__out = outbuf;
+		 size_t __inleft = sizeof (inbuf);
+		 size_t __outleft = sizeof (outbuf);
+		 iconv (cd, NULL, NULL, NULL, NULL);
+		 BENCH_USE (iconv (cd, &__in, &__inleft, &__out, &__outleft)));
+      iconv_close (cd);
+    }
+
+  return 0;
+}
+#else
+int
+main (void)
+{
+  return 0;
+}
+#endif
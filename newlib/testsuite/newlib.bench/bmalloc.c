@@ -0,0 +1,60 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Allocator fast paths and a mixed-size workload.  */
+
+#include <stdlib.h>
+#include "bench.h"
+
+#ifndef NSLOTS
+#define NSLOTS 256
+#endif
+
+static void *slots[NSLOTS];
+
+static const unsigned long sizes[] = { 8, 16, 32, 64, 128, 512, 1024, 4096 };
+#define NSIZES (sizeof (sizes) / sizeof (sizes[0]))
+
+/* Deterministic pseudo random sequence, independent of rand ().  */
+static unsigned long
+next (unsigned long *state)
+{
+  *state = *state * 1103515245UL + 12345UL;
+  return *state >> 16;
+}
+
+int
+main (void)
+{
+  unsigned long i, seed = 1;
+  void *p;
+
+  for (i = 0; i < NSIZES; i++)
+    {
+      unsigned long n = sizes[i];
+
+      BENCH_RUN ("malloc-free", n, p = malloc (n); BENCH_USE (p); free (p));
+      BENCH_RUN ("calloc-free", n, p = calloc (1, n); BENCH_USE (p); free (p));
+    }
+
+  BENCH_RUN ("realloc-grow", 4096,
+	     unsigned long __n;
+	     p = NULL;
+	     for (__n = 16; __n <= 4096; __n *= 2)
+	       p = realloc (p, __n);
+	     BENCH_USE (p);
+	     free (p));
+
+  BENCH_RUN ("mixed", NSLOTS,
+	     unsigned long __r = next (&seed);
+	     unsigned long __s = __r % NSLOTS;
+	     free (slots[__s]);
+	     slots[__s] = malloc (sizes[(__r >> 8) % NSIZES]);
+	     BENCH_USE (slots[__s]));
+
+  for (i = 0; i < NSLOTS; i++)
+    free (slots[i]);
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* qsort, bsearch, the tsearch family and hsearch.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <search.h>
+#include "bench.h"
+
+#ifndef NELEM
+#define NELEM 4096
+#endif
+
+static int data[NELEM];
+static int sorted[NELEM];
+static char keys[NELEM][12];
+
+static int
+cmp_int (const void *a, const void *b)
+{
+  int x = *(const int *) a;
+  int y = *(const int *) b;
+
+  return (x > y) - (x < y);
+}
+
+static unsigned long
+next (unsigned long *state)
+{
+  *state = *state * 1103515245UL + 12345UL;
+  return *state >> 16;
+}
+
+int
+main (void)
+{
+  unsigned long i, n, seed = 1;
+  void *root = NULL;
+  ENTRY e;
+
+  for (i = 0; i < NELEM; i++)
+    data[i] = (int) next (&seed);
+
+  for (n = 16; n <= NELEM; n *= 4)
+    {
+      BENCH_RUN ("qsort/random", n,
+		 memcpy (sorted, data, n * sizeof (int));
+		 qsort (sorted, n, sizeof (int), cmp_int));
+      BENCH_RUN ("qsort/sorted", n, qsort (sorted, n, sizeof (int), cmp_int));
+      BENCH_RUN ("bsearch", n,
+		 int __k = data[next (&seed) % n];
+		 BENCH_USE (bsearch (&__k, sorted, n, sizeof (int), cmp_int)));
+    }
+
+  for (i = 0; i < NELEM; i++)
+    tsearch (&data[i], &root, cmp_int);
+  BENCH_RUN ("tfind", NELEM,
+	     BENCH_USE (tfind (&data[next (&seed) % NELEM], &root, cmp_int)));
+  BENCH_RUN ("tsearch-tdelete", NELEM,
+	     int __k = -1;
+	     tsearch (&__k, &root, cmp_int);
+	     tdelete (&__k, &root, cmp_int));
+  for (i = 0; i < NELEM; i++)
+    tdelete (&data[i], &root, cmp_int);
+
+  if (hcreate (NELEM * 2))
+    {
+      for (i = 0; i < NELEM; i++)
+	{
+	  sprintf (keys[i], "key%lu", i);
+	  e.key = keys[i];
+	  e.data = &data[i];
+	  hsearch (e, ENTER);
+	}
+      BENCH_RUN ("hsearch/find", NELEM,
+		 e.key = keys[next (&seed) % NELEM];
+		 BENCH_USE (hsearch (e, FIND)));
+      e.key = (char *) "absent";
+      BENCH_RUN ("hsearch/miss", NELEM, BENCH_USE (hsearch (e, FIND)));
+      hdestroy ();
+    }
+
+  return 0;
+}
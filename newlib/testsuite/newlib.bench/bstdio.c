@@ -0,0 +1,64 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Formatted and buffered stdio.  Output goes to memory so that the
+   benchmark does not depend on the host or simulator file system.  */
+
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+
+static char buf[4096];
+
+int
+main (void)
+{
+  int i;
+  long l;
+  double d;
+  char s[64];
+  FILE *fp;
+
+  BENCH_RUN ("sprintf/%d", 0, BENCH_USE (sprintf (buf, "%d", 123456789)));
+  BENCH_RUN ("sprintf/%x", 0, BENCH_USE (sprintf (buf, "%08x", 0xdeadbeef)));
+  BENCH_RUN ("sprintf/%s", 0, BENCH_USE (sprintf (buf, "%s:%s", "hello", "world")));
+  BENCH_RUN ("sprintf/%ld-list", 0,
+	     BENCH_USE (sprintf (buf, "%ld %ld %ld %ld", 1L, -22L, 333L, -4444L)));
+  BENCH_RUN ("sprintf/%g", 0, BENCH_USE (sprintf (buf, "%g", 3.14159265358979)));
+  BENCH_RUN ("sprintf/%.17g", 0, BENCH_USE (sprintf (buf, "%.17g", 1.0 / 3.0)));
+  BENCH_RUN ("sprintf/%f", 0, BENCH_USE (sprintf (buf, "%f", 1234567.125)));
+  BENCH_RUN ("sprintf/%e", 0, BENCH_USE (sprintf (buf, "%e", 6.02214076e23)));
+
+  BENCH_RUN ("sscanf/%d", 0, sscanf ("123456789", "%d", &i); BENCH_USE (i));
+  BENCH_RUN ("sscanf/%ld%ld", 0,
+	     sscanf ("-98765 43210", "%ld %ld", &l, &l); BENCH_USE (l));
+  BENCH_RUN ("sscanf/%s", 0, sscanf ("token rest", "%63s", s); BENCH_USE (s[0]));
+  BENCH_RUN ("sscanf/%lf", 0, sscanf ("2.718281828459045", "%lf", &d);
+	     BENCH_USE (d));
+
+  fp = fmemopen (buf, sizeof (buf), "w");
+  if (fp != NULL)
+    {
+      BENCH_RUN ("fputc", 0, if (putc ('x', fp) == EOF) rewind (fp));
+      rewind (fp);
+      BENCH_RUN ("fputs", 0, if (fputs ("0123456789abcdef", fp) == EOF) rewind (fp));
+      rewind (fp);
+      BENCH_RUN ("fwrite", 64, if (fwrite (buf, 1, 64, fp) != 64) rewind (fp));
+      rewind (fp);
+      BENCH_RUN ("fprintf/%d", 0, if (fprintf (fp, "%d\n", 42) < 0) rewind (fp));
+      fclose (fp);
+    }
+
+  memset (buf, 'r', sizeof (buf));
+  fp = fmemopen (buf, sizeof (buf), "r");
+  if (fp != NULL)
+    {
+      BENCH_RUN ("fgetc", 0, i = getc (fp); if (i == EOF) rewind (fp); BENCH_USE (i));
+      rewind (fp);
+      BENCH_RUN ("fread", 64, if (fread (s, 1, 64, fp) != 64) rewind (fp); BENCH_USE (s[0]));
+      fclose (fp);
+    }
+
+  return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Size and alignment sweeps over the string and memory routines.  */
+
+#include <string.h>
+#include <stdlib.h>
+#include "bench.h"
+
+#ifndef MAX_SIZE
+#define MAX_SIZE 16384
+#endif
+
+#define BUFF_SIZE (MAX_SIZE + 64)
+
+static const unsigned long sizes[] =
+  { 1, 4, 8, 15, 16, 32, 64, 100, 256, 1024, 4096, MAX_SIZE };
+#define NSIZES (sizeof (sizes) / sizeof (sizes[0]))
+
+static const unsigned int aligns[][2] = { { 0, 0 }, { 1, 0 }, { 0, 3 }, { 5, 7 } };
+#define NALIGNS (sizeof (aligns) / sizeof (aligns[0]))
+
+static char src_buf[BUFF_SIZE] __attribute__ ((aligned (64)));
+static char dst_buf[BUFF_SIZE] __attribute__ ((aligned (64)));
+
+int
+main (void)
+{
+  char name[32];
+  unsigned long i, a;
+
+  for (i = 0; i < BUFF_SIZE; i++)
+    src_buf[i] = 'a' + i % 26;
+
+  for (a = 0; a < NALIGNS; a++)
+    for (i = 0; i < NSIZES; i++)
+      {
+	char *d = dst_buf + aligns[a][0];
+	char *s = src_buf + aligns[a][1];
+	unsigned long n = sizes[i];
+
+	sprintf (name, "memcpy/%u-%u", aligns[a][0], aligns[a][1]);
+	BENCH_RUN (name, n, memcpy (d, s, n); BENCH_USE (d[0]));
+	sprintf (name, "memmove/%u-%u", aligns[a][0], aligns[a][1]);
+	BENCH_RUN (name, n, memmove (s + 1, s, n); BENCH_USE (s[1]));
+	sprintf (name, "memcmp/%u-%u", aligns[a][0], aligns[a][1]);
+	memcpy (d, s, n);
+	BENCH_RUN (name, n, BENCH_USE (memcmp (d, s, n)));
+      }
+
+  for (a = 0; a < 4; a++)
+    for (i = 0; i < NSIZES; i++)
+      {
+	char *s = src_buf + a;
+	unsigned long n = sizes[i];
+
+	sprintf (name, "memset/%lu", a);
+	BENCH_RUN (name, n, memset (s, 'x', n); BENCH_USE (s[0]));
+	sprintf (name, "memchr/%lu", a);
+	s[n - 1] = 'y';
+	BENCH_RUN (name, n, BENCH_USE (memchr (s, 'y', n)));
+	s[n - 1] = 'x';
+	memcpy (dst_buf + a, s, n);
+	s[n] = dst_buf[a + n] = '\0';
+	sprintf (name, "strlen/%lu", a);
+	BENCH_RUN (name, n, BENCH_USE (strlen (s)));
+	sprintf (name, "strchr/%lu", a);
+	BENCH_RUN (name, n, BENCH_USE (strchr (s, 'y')));
+	sprintf (name, "strcmp/%lu", a);
+	BENCH_RUN (name, n, BENCH_USE (strcmp (s, dst_buf + a)));
+	sprintf (name, "strcpy/%lu", a);
+	BENCH_RUN (name, n, BENCH_USE (strcpy (dst_buf + a, s)));
+	s[n] = 'x';
+      }
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* String to number conversions and the dtoa based formatting paths.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+
+static const char *const inputs[] =
+{
+  "0", "1", "42", "3.14159", "-0.000123", "1e10", "6.02214076e23",
+  "2.2250738585072014e-308", "1.7976931348623157e308",
+  "0.1000000000000000055511151231257827", "123456789012345678901234567890"
+};
+#define NINPUTS (sizeof (inputs) / sizeof (inputs[0]))
+
+static const double values[] =
+{
+  0.0, 1.0, 0.1, 1.0 / 3.0, 123456.789, 6.02214076e23, 1e-300, 1.7976931348623157e308
+};
+#define NVALUES (sizeof (values) / sizeof (values[0]))
+
+int
+main (void)
+{
+  char name[48];
+  char buf[64];
+  unsigned long i;
+
+  for (i = 0; i < NINPUTS; i++)
+    {
+      const char *s = inputs[i];
+
+      sprintf (name, "strtod/%lu", i);
+      BENCH_RUN (name, 0, BENCH_USE (strtod (s, NULL) != 0.0));
+      sprintf (name, "strtof/%lu", i);
+      BENCH_RUN (name, 0, BENCH_USE (strtof (s, NULL) != 0.0f));
+    }
+
+  BENCH_RUN ("strtol/dec", 0, BENCH_USE (strtol ("-1234567890", NULL, 10)));
+  BENCH_RUN ("strtoul/hex", 0, BENCH_USE (strtoul ("0xdeadbeef", NULL, 16)));
+  BENCH_RUN ("atoi", 0, BENCH_USE (atoi ("987654")));
+
+  for (i = 0; i < NVALUES; i++)
+    {
+      double v = values[i];
+
+      sprintf (name, "dtoa/%%.17g/%lu", i);
+      BENCH_RUN (name, 0, BENCH_USE (sprintf (buf, "%.17g", v)));
+      sprintf (name, "dtoa/%%g/%lu", i);
+      BENCH_RUN (name, 0, BENCH_USE (sprintf (buf, "%g", v)));
+#ifdef _WANT_IO_LONG_DOUBLE
+      sprintf (name, "ldtoa/%%Lg/%lu", i);
+      BENCH_RUN (name, 0, BENCH_USE (sprintf (buf, "%Lg", (long double) v)));
+#endif
+    }
+
+  return 0;
+}
@@ -0,0 +1,37 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Broken-down time conversions, formatting and parsing.  */
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <time.h>
+#include "bench.h"
+
+int
+main (void)
+{
+  time_t t = 1700000000;
+  struct tm tm;
+  char buf[64];
+
+  setenv ("TZ", "EST5EDT,M3.2.0,M11.1.0", 1);
+  tzset ();
+
+  BENCH_RUN ("gmtime_r", 0, t += 3607; BENCH_USE (gmtime_r (&t, &tm)));
+  BENCH_RUN ("localtime_r", 0, t += 3607; BENCH_USE (localtime_r (&t, &tm)));
+  localtime_r (&t, &tm);
+  BENCH_RUN ("mktime", 0, tm.tm_isdst = -1; BENCH_USE (mktime (&tm)));
+  BENCH_RUN ("tzset", 0, tzset ());
+  BENCH_RUN ("strftime/iso8601", 0,
+	     BENCH_USE (strftime (buf, sizeof (buf), "%Y-%m-%dT%H:%M:%S", &tm)));
+  BENCH_RUN ("strftime/%c", 0, BENCH_USE (strftime (buf, sizeof (buf), "%c", &tm)));
+  BENCH_RUN ("strptime/iso8601", 0,
+	     BENCH_USE (strptime ("2023-11-14T22:13:20", "%Y-%m-%dT%H:%M:%S", &tm)));
+  BENCH_RUN ("strptime/%b", 0,
+	     BENCH_USE (strptime ("Nov 14 22:13:20 2023", "%b %d %H:%M:%S %Y", &tm)));
+  BENCH_RUN ("asctime_r", 0, BENCH_USE (asctime_r (&tm, buf)));
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Check memchr on every length up to MAX_BLOCK_SIZE and every alignment
+   within a vector, with the character at each position, missing, and
+   only just past the end.  This covers the tail and the early exit of
+   vectorized versions.  */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+
+#ifndef MAX_BLOCK_SIZE
+#define MAX_BLOCK_SIZE 80
+#endif
+
+#ifndef MAX_OFFSET
+#define MAX_OFFSET 15
+#endif
+
+#define BUFF_SIZE (MAX_BLOCK_SIZE + MAX_OFFSET + 64)
+
+#define TOO_MANY_ERRORS 11
+int errors = 0;
+
+void
+print_error (char const* msg, ...)
+{
+  errors++;
+  if (errors == TOO_MANY_ERRORS)
+    {
+      fprintf (stderr, "Too many errors.\n");
+    }
+  else if (errors < TOO_MANY_ERRORS)
+    {
+      va_list ap;
+      va_start (ap, msg);
+      vfprintf (stderr, msg, ap);
+      va_end (ap);
+    }
+  else
+    {
+      /* Further errors omitted.  */
+    }
+}
+
+int
+main (void)
+{
+  unsigned char raw[BUFF_SIZE + 32];
+  /* Start on a 32-byte boundary so that the offsets are alignments.  */
+  unsigned char *buf = raw + (-(uintptr_t) raw & 31);
+  unsigned char *s;
+  void *ret, *want;
+  unsigned sa, n, pos;
+  int c, i;
+
+  srand (1539);
+  for (sa = 0; sa <= MAX_OFFSET; sa++)
+    for (n = 0; n <= MAX_BLOCK_SIZE; n++)
+      /* pos == n: not there; pos == n + 1: only just past the end.  */
+      for (pos = 0; pos <= n + 1; pos++)
+	{
+	  c = 0x80 | (rand () & 0x7f);
+	  /* The filler never matches C.  */
+	  for (i = 0; i < BUFF_SIZE; i++)
+	    buf[i] = rand () & 0x7f;
+	  s = buf + sa;
+	  want = NULL;
+	  if (pos < n)
+	    {
+	      s[pos] = c;
+	      /* Only the first match counts.  */
+	      s[n - 1] = c;
+	      want = s + pos;
+	    }
+	  else if (pos == n + 1)
+	    memset (s + n, c, 32);
+
+	  /* Pass a character with bits set above the low byte.  */
+	  ret = memchr (s, c | 0x1200, n);
+	  if (ret != want)
+	    print_error ("\nFailed: memchr of %u bytes with align %u and "
+			 "character at %u returned %p instead of %p\n",
+			 n, sa, pos, ret, want);
+	}
+
+  if (errors != 0)
+    abort ();
+
+  exit (0);
+}
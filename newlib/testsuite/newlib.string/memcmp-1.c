@@ -0,0 +1,112 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Check memcmp on every length up to MAX_BLOCK_SIZE with misaligned
+   operands, with one difference at each position, none, and one only
+   just past the end.  The differing bytes straddle 0x80 to check that
+   bytes compare as unsigned.  This covers the tail and the early exit
+   of vectorized versions.  */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+
+#ifndef MAX_BLOCK_SIZE
+#define MAX_BLOCK_SIZE 80
+#endif
+
+#ifndef MAX_OFFSET
+#define MAX_OFFSET 15
+#endif
+
+#define BUFF_SIZE (MAX_BLOCK_SIZE + MAX_OFFSET + 64)
+
+#define TOO_MANY_ERRORS 11
+int errors = 0;
+
+void
+print_error (char const* msg, ...)
+{
+  errors++;
+  if (errors == TOO_MANY_ERRORS)
+    {
+      fprintf (stderr, "Too many errors.\n");
+    }
+  else if (errors < TOO_MANY_ERRORS)
+    {
+      va_list ap;
+      va_start (ap, msg);
+      vfprintf (stderr, msg, ap);
+      va_end (ap);
+    }
+  else
+    {
+      /* Further errors omitted.  */
+    }
+}
+
+static int
+sign (int x)
+{
+  return (x > 0) - (x < 0);
+}
+
+int
+main (void)
+{
+  unsigned char raw1[BUFF_SIZE + 32], raw2[BUFF_SIZE + 32];
+  unsigned char *buf1 = raw1 + (-(uintptr_t) raw1 & 31);
+  unsigned char *buf2 = raw2 + (-(uintptr_t) raw2 & 31);
+  unsigned char *s1, *s2;
+  unsigned sa1, sa2, n, pos;
+  int i, want, ret;
+
+  srand (1539);
+  for (sa1 = 0; sa1 <= MAX_OFFSET; sa1++)
+    for (sa2 = 0; sa2 <= MAX_OFFSET; sa2 += 5)
+      for (n = 0; n <= MAX_BLOCK_SIZE; n++)
+	/* pos == n: equal; pos == n + 1: differ only just past the end.  */
+	for (pos = 0; pos <= n + 1; pos++)
+	  {
+	    for (i = 0; i < BUFF_SIZE; i++)
+	      buf1[i] = buf2[i] = rand ();
+	    s1 = buf1 + sa1;
+	    s2 = buf2 + sa2;
+	    memcpy (s2, s1, n);
+	    want = 0;
+	    if (pos < n)
+	      {
+		s1[pos] = 0x7f;
+		s2[pos] = 0x80;
+		want = -1;
+		if (pos & 1)
+		  {
+		    s1[pos] = 0x80;
+		    s2[pos] = 0x7f;
+		    want = 1;
+		  }
+		/* Only the first difference counts.  */
+		if (pos + 1 < n)
+		  s1[n - 1] = s2[n - 1] + 1;
+	      }
+	    else if (pos == n + 1)
+	      {
+		memset (s1 + n, 1, 32);
+		memset (s2 + n, 2, 32);
+	      }
+
+	    ret = memcmp (s1, s2, n);
+	    if (sign (ret) != want)
+	      print_error ("\nFailed: memcmp of %u bytes with aligns %u, %u "
+			   "and difference at %u returned %d\n",
+			   n, sa1, sa2, pos, ret);
+	  }
+
+  if (errors != 0)
+    abort ();
+
+  exit (0);
+}
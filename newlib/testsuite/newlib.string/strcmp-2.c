@@ -0,0 +1,110 @@
+/*
+ * This file is in the public domain.
+ */
+
+/* Check strcmp with both strings at every offset within a 32-byte
+   block, so that the terminator and the first difference fall on each
+   side of a 32-byte boundary.  strcmp-1.c only tests small offsets.  */
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdarg.h>
+
+#ifndef MAX_LEN
+#define MAX_LEN 40
+#endif
+
+#define BUFF_SIZE (MAX_LEN + 32 + 64)
+
+#define TOO_MANY_ERRORS 11
+int errors = 0;
+
+void
+print_error (char const* msg, ...)
+{
+  errors++;
+  if (errors == TOO_MANY_ERRORS)
+    {
+      fprintf (stderr, "Too many errors.\n");
+    }
+  else if (errors < TOO_MANY_ERRORS)
+    {
+      va_list ap;
+      va_start (ap, msg);
+      vfprintf (stderr, msg, ap);
+      va_end (ap);
+    }
+  else
+    {
+      /* Further errors omitted.  */
+    }
+}
+
+static int
+sign (int x)
+{
+  return (x > 0) - (x < 0);
+}
+
+int
+main (void)
+{
+  char raw1[BUFF_SIZE + 32], raw2[BUFF_SIZE + 32];
+  char *buf1 = raw1 + (-(uintptr_t) raw1 & 31);
+  char *buf2 = raw2 + (-(uintptr_t) raw2 & 31);
+  char *s1, *s2;
+  unsigned sa1, sa2, len, kind;
+  int i, want, ret;
+
+  srand (1539);
+  for (sa1 = 0; sa1 < 32; sa1++)
+    for (sa2 = 0; sa2 < 32; sa2++)
+      for (len = 0; len <= MAX_LEN; len++)
+	for (kind = 0; kind < 4; kind++)
+	  {
+	    /* Garbage after the terminators must not matter.  */
+	    for (i = 0; i < BUFF_SIZE; i++)
+	      buf1[i] = buf2[i] = (char) rand ();
+	    s1 = buf1 + sa1;
+	    s2 = buf2 + sa2;
+	    for (i = 0; i < (int) len; i++)
+	      s1[i] = s2[i] = 0x20 + (rand () & 0x3f);
+	    s1[len] = s2[len] = '\0';
+	    want = 0;
+	    switch (kind)
+	      {
+	      case 1:
+		/* Differ in the last character, as unsigned bytes.  */
+		if (len == 0)
+		  break;
+		s1[len - 1] = (char) 0x80;
+		want = 1;
+		break;
+	      case 2:
+		/* s2 is one character longer.  */
+		s2[len] = 'x';
+		s2[len + 1] = '\0';
+		want = -1;
+		break;
+	      case 3:
+		/* s1 is one character longer.  */
+		s1[len] = 'x';
+		s1[len + 1] = '\0';
+		want = 1;
+		break;
+	      }
+
+	    ret = strcmp (s1, s2);
+	    if (sign (ret) != want)
+	      print_error ("\nFailed: strcmp of %u characters with aligns "
+			   "%u, %u (case %u) returned %d\n",
+			   len, sa1, sa2, kind, ret);
+	  }
+
+  if (errors != 0)
+    abort ();
+
+  exit (0);
+}